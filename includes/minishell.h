@@ -25,7 +25,10 @@
 # include <sys/types.h>
 # include <sys/wait.h>
 # include <sys/stat.h>
+# include <sys/time.h>
+# include <sys/resource.h>
 # include <fcntl.h>
+# include <limits.h>
 # include <signal.h>
 # include <errno.h>
 # include <dirent.h>
@@ -38,9 +41,28 @@
 /* ************************************************************************** */
 
 # define PROMPT "minishell$ "
-# define MAX_CMD_LEN 1024
-# define MAX_ARGS 128
+# define VEC_MIN_CAP 16
+# define BUF_MIN_CAP 256
+# define ARITH_MAX_DEPTH 1024
+# define READ_AHEAD_SIZE 65536
+# define READ_CACHE_SLOTS 16
+
+/* Two-character arithmetic operators, encoded as c1 | c2 << 8 */
+# define ARITH_OR 0x7c7c
+# define ARITH_AND 0x2626
+# define ARITH_EQ 0x3d3d
+# define ARITH_NE 0x3d21
+# define ARITH_LE 0x3d3c
+# define ARITH_GE 0x3d3e
+# define ARITH_SHL 0x3c3c
+# define ARITH_SHR 0x3e3e
+# define ARITH_POW 0x2a2a
 # define MAX_ENV_VARS 1024
+# define FD_TRANSFER_BUF 1048576
+
+/* Line reading modes */
+# define LINE_PROMPT 0
+# define LINE_HEREDOC 1
 
 /* Exit codes */
 # define EXIT_SUCCESS 0
@@ -86,6 +108,82 @@ typedef struct s_cmd
 	struct s_cmd	*next;
 }	t_cmd;
 
+/**
+ * @brief Growable NULL-terminated string vector (argument lists)
+ */
+typedef struct s_strvec
+{
+	char	**data;
+	size_t	len;
+	size_t	cap;
+}	t_strvec;
+
+/**
+ * @brief Growable NUL-terminated byte buffer (input lines, words)
+ */
+typedef struct s_strbuf
+{
+	char	*data;
+	size_t	len;
+	size_t	cap;
+}	t_strbuf;
+
+/**
+ * @brief Resource usage of one pipeline stage, filled by wait4()
+ */
+typedef struct s_stage_usage
+{
+	pid_t			pid;
+	int				status;
+	struct rusage	ru;
+	struct timeval	end;
+}	t_stage_usage;
+
+/**
+ * @brief Parser state of the `test` / `[` builtin
+ */
+typedef struct s_test
+{
+	char	*name;
+	char	**av;
+	int		argc;
+	int		pos;
+	int		err;
+}	t_test;
+
+/**
+ * @brief Parser state of an arithmetic expansion
+ */
+typedef struct s_arith
+{
+	const char		*s;
+	size_t			i;
+	struct s_shell	*shell;
+	int				err;
+	int				noeval;
+	int				depth;
+}	t_arith;
+
+/**
+ * @brief Readahead window of the `read` builtin on a regular file
+ *
+ * buf[start, end) holds the file bytes at offsets [base + start,
+ * base + end); the fd itself is kept at base + start.
+ */
+typedef struct s_readahead
+{
+	int		valid;
+	int		fd;
+	dev_t	dev;
+	ino_t	ino;
+	off_t	size;
+	time_t	mtime;
+	off_t	base;
+	size_t	start;
+	size_t	end;
+	char	*buf;
+}	t_readahead;
+
 /**
  * @brief Shell data structure
  */
@@ -95,6 +193,8 @@ typedef struct s_shell
 	int		exit_status;
 	int		should_exit;
 	char	*input;
+	int		sig_fd;
+	int		interrupted;
 }	t_shell;
 
 /* ************************************************************************** */
@@ -122,17 +222,58 @@ int		is_builtin(char *cmd);
 int		execute_builtin(t_cmd *cmd, t_shell *shell);
 int		execute_external(t_cmd *cmd, t_shell *shell);
 
+/* test / [ builtin */
+int		builtin_test(char **args);
+int		test_expr(t_test *t);
+int		test_error(t_test *t, const char *arg, const char *msg);
+int		is_unary_op(const char *op);
+int		is_binary_op(const char *op);
+int		eval_unary(t_test *t, const char *op, const char *arg);
+int		eval_binary(t_test *t, const char *l, const char *op, const char *r);
+
+/* read builtin */
+int		builtin_read(char **args, t_shell *shell);
+int		read_parse_args(char **args, int *raw, int *first);
+int		read_assign(char **names, char *line, t_shell *shell, int raw);
+int		read_line_fd(int fd, t_strbuf *line);
+t_readahead	*read_slot(int fd);
+void	read_slot_reset(t_readahead *ra, int fd, struct stat *st, off_t cur);
+ssize_t	read_slot_refill(t_readahead *ra);
+void	read_cache_release(void);
+int		check_exec_size(char **argv, char **envp);
+
 /* Pipe and redirection functions */
 int		setup_pipes(t_cmd *commands);
 int		handle_redirections(t_cmd *cmd);
 int		redirect_input(char *filename);
 int		redirect_output(char *filename, int append);
 int		handle_heredoc(char *delimiter);
+ssize_t	fd_transfer(int in_fd, int out_fd);
 
 /* Variable expansion */
 char	*expand_variables(char *str, t_shell *shell);
 char	*expand_exit_status(char *str, int exit_status);
 
+/* Word expansion */
+char	*expand_word(const char *str, t_shell *shell);
+size_t	skip_quoted(const char *str, size_t i);
+long	find_paren_end(const char *str, size_t i);
+
+/* Arithmetic expansion */
+int		append_arith(t_strbuf *buf, const char *str, size_t *i,
+			t_shell *shell);
+int		eval_arith(const char *expr, t_shell *shell, long long *out);
+long long	arith_expr(t_arith *a);
+long long	arith_operand(t_arith *a);
+long long	arith_variable(t_arith *a);
+long long	arith_apply(t_arith *a, int op, long long l, long long r);
+long long	arith_div(t_arith *a, int op, long long l, long long r);
+long long	arith_pow(t_arith *a, long long base, long long exp);
+long long	arith_error(t_arith *a, const char *msg);
+int		arith_enter(t_arith *a);
+int		arith_peek_op(t_arith *a, int *prec);
+void	arith_skip_spaces(t_arith *a);
+
 /* Path resolution */
 char	*find_executable(char *cmd, char **env);
 char	**get_path_dirs(char **env);
@@ -155,22 +296,54 @@ char	*ft_getenv(const char *name, char **env);
 void	ft_setenv(const char *name, const char *value, char ***env);
 int		ft_strcmp(const char *s1, const char *s2);
 char	*ft_strjoin(char const *s1, char const *s2);
-int		ft_strlen(const char *s);
+size_t	ft_strlen(const char *s);
 int		ft_isdigit(int c);
 int		ft_isalpha(int c);
 int		ft_isalnum(int c);
 char	*ft_itoa(int n);
+char	*ft_lltoa(long long n);
 int		ft_atoi(const char *str);
+int		ft_atoll(const char *str, long long *out);
 char	*ft_strchr(const char *s, int c);
 int		ft_strncmp(const char *s1, const char *s2, size_t n);
 void	*ft_memcpy(void *dst, const void *src, size_t n);
+void	*ft_memset(void *dst, int c, size_t n);
+
+/* Growable vectors and buffers */
+void	strvec_init(t_strvec *vec);
+int		strvec_push(t_strvec *vec, char *str);
+char	**strvec_release(t_strvec *vec);
+void	strvec_free(t_strvec *vec);
+void	strbuf_init(t_strbuf *buf);
+int		strbuf_reserve(t_strbuf *buf, size_t extra);
+int		strbuf_append(t_strbuf *buf, const char *str, size_t n);
+char	*strbuf_release(t_strbuf *buf);
+void	strbuf_free(t_strbuf *buf);
 
 /* Process management */
 pid_t	ft_fork(void);
 int		wait_for_children(pid_t *pids, int count);
+int		wait_children_usage(pid_t *pids, int count, t_stage_usage *usage);
+void	wait_exit_order(pid_t *pids, int count, t_stage_usage *usage);
+void	record_stage_usage(t_stage_usage *usage, pid_t pid, int status,
+			struct rusage *ru);
+
+/* `time` reserved word */
+int		strip_time_keyword(t_cmd *cmd);
+void	print_time_report(t_cmd *cmds, t_stage_usage *usage, int count,
+			struct timeval *start);
 
 /* Shell loop functions */
 void	shell_loop(t_shell *shell);
+char	*shell_readline(t_shell *shell, const char *prompt, int mode);
+
+/* Signal handling */
+int		signals_init(t_shell *shell);
+int		signals_next(int sig_fd);
+void	signals_reset_child(void);
+void	reap_children(t_shell *shell);
+void	discard_pending_signals(t_shell *shell);
+int		status_to_exit_code(int status);
 
 /* Error handling */
 void	print_error(const char *message);
@@ -25,9 +25,11 @@
  * - Use perror() or custom error messages for user feedback
  * 
  * SIGNAL SAFETY:
- * - Signal handlers must be async-signal-safe
- * - Use volatile sig_atomic_t for signal communication variables
- * - Minimal work in signal handlers, defer complex operations
+ * - SIGINT/SIGQUIT/SIGCHLD are blocked and read from t_shell.sig_fd
+ *   (signalfd, or a self-pipe where signalfd is unavailable)
+ * - Signals are handled synchronously by the shell_readline() event loop,
+ *   never from async handlers
+ * - Children call signals_reset_child() before execve()
  * 
  * BASH COMPATIBILITY:
  * - Match bash behavior for edge cases and error conditions
@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_read.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+/**
+ * @brief Removes a trailing backslash-newline from the logical line
+ *
+ * Only an unescaped backslash continues the line: the run of
+ * backslashes before the newline must be odd. Other escapes are kept
+ * for read_assign(), which must see them to split fields correctly.
+ *
+ * @return int 1 if the line continues on the next physical line
+ */
+static int	join_continuation(t_strbuf *out)
+{
+	size_t	count;
+
+	if (out->len < 2 || out->data[out->len - 1] != '\n')
+		return (0);
+	count = 0;
+	while (count + 1 < out->len && out->data[out->len - 2 - count] == '\\')
+		count++;
+	if (count % 2 == 0)
+		return (0);
+	out->len -= 2;
+	out->data[out->len] = '\0';
+	return (1);
+}
+
+/**
+ * @brief Reads one logical line: without -r, backslash-newline joins
+ *        the next physical line
+ * @return int 1 on a full line, 0 on EOF, -1 on error
+ */
+static int	read_logical_line(int raw, t_strbuf *out)
+{
+	t_strbuf	line;
+	int			ret;
+	int			more;
+
+	strbuf_init(&line);
+	more = 1;
+	ret = 1;
+	while (more && ret == 1)
+	{
+		line.len = 0;
+		ret = read_line_fd(STDIN_FILENO, &line);
+		if (ret < 0 || line.len == 0)
+			break ;
+		if (strbuf_append(out, line.data, line.len) < 0)
+			ret = -1;
+		more = !raw && join_continuation(out);
+	}
+	strbuf_free(&line);
+	return (ret);
+}
+
+/**
+ * @brief The `read` builtin: `read [-r] [name ...]`
+ *
+ * Lines come from read_line_fd(), which serves regular files from a
+ * readahead buffer shared across calls and falls back to byte-wise
+ * reads on pipes and terminals. At EOF the names are still assigned
+ * from whatever was read, empty strings if nothing was.
+ *
+ * @return int 0 if a line was read, 1 on EOF or error, 2 on bad usage
+ */
+int	builtin_read(char **args, t_shell *shell)
+{
+	t_strbuf	line;
+	int			raw;
+	int			first;
+	int			ret;
+
+	ret = read_parse_args(args, &raw, &first);
+	if (ret != 0)
+		return (ret);
+	strbuf_init(&line);
+	ret = read_logical_line(raw, &line);
+	if (ret >= 0 && strbuf_reserve(&line, 0) != 0)
+		ret = -1;
+	if (ret >= 0)
+	{
+		if (line.len > 0 && line.data[line.len - 1] == '\n')
+			line.data[--line.len] = '\0';
+		if (read_assign(args + first, line.data, shell, raw) != 0)
+			ret = -1;
+	}
+	strbuf_free(&line);
+	if (ret == 1)
+		return (EXIT_SUCCESS);
+	return (EXIT_FAILURE);
+}
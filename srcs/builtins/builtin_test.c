@@ -0,0 +1,83 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_test.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+/**
+ * @brief POSIX rules for up to three operands, which override the grammar
+ *
+ * `[ -n = x ]` compares strings and `[ ! -z ]` negates a one-operand
+ * test, whatever the operands look like.
+ *
+ * @return int 1 if a rule applied (result stored), 0 otherwise
+ */
+static int	test_shortcut(t_test *t, int *result)
+{
+	if (t->argc == 1)
+		*result = (t->av[0][0] != '\0');
+	else if (t->argc == 2 && ft_strcmp(t->av[0], "!") == 0)
+		*result = (t->av[1][0] == '\0');
+	else if (t->argc == 3 && is_binary_op(t->av[1]))
+		*result = eval_binary(t, t->av[0], t->av[1], t->av[2]);
+	else
+		return (0);
+	t->pos = t->argc;
+	return (1);
+}
+
+static int	count_args(char **args)
+{
+	int	count;
+
+	count = 0;
+	while (args[count])
+		count++;
+	return (count);
+}
+
+/**
+ * @brief The `test` and `[` builtins
+ *
+ * Evaluated in-process so conditionals such as `[ -f x ] && ...` cost
+ * no fork/exec of /usr/bin/test.
+ *
+ * @param args args[0] is "test" or "[", in which case the last argument
+ *        must be "]"
+ * @return int 0 if the expression is true, 1 if false, 2 on error
+ */
+int	builtin_test(char **args)
+{
+	t_test	t;
+	int		argc;
+	int		result;
+
+	argc = count_args(args);
+	t.name = args[0];
+	if (ft_strcmp(args[0], "[") == 0
+		&& (argc < 2 || ft_strcmp(args[argc - 1], "]") != 0))
+		return (test_error(&t, NULL, "missing `]'"));
+	if (ft_strcmp(args[0], "[") == 0)
+		argc--;
+	t.av = args + 1;
+	t.argc = argc - 1;
+	t.pos = 0;
+	t.err = 0;
+	if (t.argc == 0)
+		return (EXIT_FAILURE);
+	if (!test_shortcut(&t, &result))
+		result = test_expr(&t);
+	if (!t.err && t.pos < t.argc)
+		test_error(&t, t.av[t.pos], "unexpected argument");
+	if (t.err)
+		return (EXIT_MISUSE);
+	return (!result);
+}
@@ -0,0 +1,44 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtins.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+/**
+ * @brief Tells whether a command name is a shell builtin
+ * @param cmd Command name (args[0])
+ * @return int 1 if cmd runs inside the shell, 0 otherwise
+ */
+int	is_builtin(char *cmd)
+{
+	if (!cmd)
+		return (0);
+	return (ft_strcmp(cmd, "test") == 0 || ft_strcmp(cmd, "[") == 0
+		|| ft_strcmp(cmd, "read") == 0);
+}
+
+/**
+ * @brief Runs a builtin in the current shell process
+ * @param cmd Command whose args[0] satisfied is_builtin()
+ * @param shell Shell state
+ * @return int Exit status of the builtin
+ */
+int	execute_builtin(t_cmd *cmd, t_shell *shell)
+{
+	if (!cmd || !cmd->args || !cmd->args[0])
+		return (EXIT_SUCCESS);
+	if (ft_strcmp(cmd->args[0], "test") == 0
+		|| ft_strcmp(cmd->args[0], "[") == 0)
+		return (builtin_test(cmd->args));
+	if (ft_strcmp(cmd->args[0], "read") == 0)
+		return (builtin_read(cmd->args, shell));
+	return (EXIT_COMMAND_NOT_FOUND);
+}
@@ -0,0 +1,76 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   read_args.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+static int	valid_name(const char *name)
+{
+	if (!ft_isalpha(*name) && *name != '_')
+		return (0);
+	while (ft_isalnum(*name) || *name == '_')
+		name++;
+	return (*name == '\0');
+}
+
+static int	check_names(char **names)
+{
+	while (*names)
+	{
+		if (!valid_name(*names))
+		{
+			fprintf(stderr, "minishell: read: `%s': not a valid identifier\n",
+				*names);
+			return (-1);
+		}
+		names++;
+	}
+	return (0);
+}
+
+static int	parse_options(char **args, int *raw, int *first)
+{
+	*raw = 0;
+	*first = 1;
+	while (args[*first] && args[*first][0] == '-' && args[*first][1])
+	{
+		if (ft_strcmp(args[*first], "--") == 0)
+		{
+			(*first)++;
+			return (0);
+		}
+		if (ft_strcmp(args[*first], "-r") != 0)
+		{
+			fprintf(stderr, "minishell: read: %s: invalid option\n",
+				args[*first]);
+			return (-1);
+		}
+		*raw = 1;
+		(*first)++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Parses `read [-r] [--] [name ...]`
+ * @param raw Set to 1 when -r is given
+ * @param first Set to the index of the first variable name
+ * @return int 0 if valid, EXIT_MISUSE on a bad option, EXIT_FAILURE on an
+ *         invalid variable name
+ */
+int	read_parse_args(char **args, int *raw, int *first)
+{
+	if (parse_options(args, raw, first) < 0)
+		return (EXIT_MISUSE);
+	if (check_names(args + *first) < 0)
+		return (EXIT_FAILURE);
+	return (0);
+}
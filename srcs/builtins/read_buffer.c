@@ -0,0 +1,137 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   read_buffer.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#define _GNU_SOURCE
+#include "../../includes/minishell.h"
+
+/**
+ * @brief Checks that the buffered bytes still describe the fd's file
+ *
+ * The fd must still be at the offset the last read left it at, on the
+ * same, unmodified file; anything else (another reader, a new
+ * redirection, a rewrite) invalidates the readahead.
+ */
+static int	slot_matches(t_readahead *ra, int fd, struct stat *st, off_t cur)
+{
+	return (ra->valid && ra->fd == fd
+		&& ra->dev == st->st_dev && ra->ino == st->st_ino
+		&& ra->size == st->st_size && ra->mtime == st->st_mtime
+		&& ra->base + (off_t)ra->start == cur);
+}
+
+/**
+ * @brief Moves buffered bytes up to and including a newline into line
+ * @return int 1 if a newline was found, 0 if the buffer ran out, -1 on
+ *         allocation failure
+ */
+static int	take_line(t_readahead *ra, t_strbuf *line)
+{
+	size_t	i;
+	int		found;
+
+	i = ra->start;
+	while (i < ra->end && ra->buf[i] != '\n')
+		i++;
+	found = (i < ra->end);
+	i += found;
+	if (strbuf_append(line, ra->buf + ra->start, i - ra->start) < 0)
+		return (-1);
+	ra->start = i;
+	return (found);
+}
+
+/**
+ * @brief Reads one line from a regular file through the readahead slot
+ *
+ * Data is fetched with pread() in large blocks; afterwards the fd offset
+ * is set back to just past the line, so commands run in the loop body
+ * see exactly the input a byte-wise read would have left them.
+ *
+ * @return int 1 on a full line, 0 on EOF, -1 on error, -2 if the slot
+ *         cannot be used (caller falls back to byte-wise reads)
+ */
+static int	read_buffered(int fd, struct stat *st, off_t cur, t_strbuf *line)
+{
+	t_readahead	*ra;
+	ssize_t		n;
+	int			ret;
+
+	ra = read_slot(fd);
+	if (!slot_matches(ra, fd, st, cur))
+		read_slot_reset(ra, fd, st, cur);
+	if (!ra->buf)
+		ra->buf = malloc(READ_AHEAD_SIZE);
+	if (!ra->buf)
+		return (-2);
+	ret = take_line(ra, line);
+	while (ret == 0)
+	{
+		n = read_slot_refill(ra);
+		if (n < 0)
+			ret = -1;
+		if (n <= 0)
+			break ;
+		ret = take_line(ra, line);
+	}
+	lseek(fd, ra->base + ra->start, SEEK_SET);
+	return (ret);
+}
+
+/**
+ * @brief POSIX-compliant fallback: one byte per read() so that no input
+ *        past the newline is consumed from pipes and terminals
+ */
+static int	read_unbuffered(int fd, t_strbuf *line)
+{
+	char	c;
+	ssize_t	n;
+
+	while (1)
+	{
+		n = read(fd, &c, 1);
+		if (n < 0 && errno == EINTR)
+			continue ;
+		if (n < 0)
+			return (-1);
+		if (n == 0)
+			return (0);
+		if (strbuf_append(line, &c, 1) < 0)
+			return (-1);
+		if (c == '\n')
+			return (1);
+	}
+}
+
+/**
+ * @brief Appends the next input line (newline included) to line
+ *
+ * Regular files go through the shared readahead buffer; unseekable or
+ * special fds (pipes, terminals, devices) are read one byte at a time.
+ *
+ * @return int 1 if a newline-terminated line was read, 0 on EOF (line
+ *         may hold a final unterminated line), -1 on error
+ */
+int	read_line_fd(int fd, t_strbuf *line)
+{
+	struct stat	st;
+	off_t		cur;
+	int			ret;
+
+	cur = lseek(fd, 0, SEEK_CUR);
+	if (cur >= 0 && fstat(fd, &st) == 0 && S_ISREG(st.st_mode))
+	{
+		ret = read_buffered(fd, &st, cur, line);
+		if (ret != -2)
+			return (ret);
+	}
+	return (read_unbuffered(fd, line));
+}
@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   read_cache.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#define _GNU_SOURCE
+#include "../../includes/minishell.h"
+
+/**
+ * @brief Readahead slot of the `read` builtin for a descriptor
+ *
+ * Slots persist across invocations so a `while read` loop reads its
+ * input in READ_AHEAD_SIZE blocks instead of one syscall per byte.
+ */
+t_readahead	*read_slot(int fd)
+{
+	static t_readahead	slots[READ_CACHE_SLOTS];
+
+	return (&slots[fd % READ_CACHE_SLOTS]);
+}
+
+/**
+ * @brief Starts a fresh, empty readahead window at offset cur
+ */
+void	read_slot_reset(t_readahead *ra, int fd, struct stat *st, off_t cur)
+{
+	ra->valid = 1;
+	ra->fd = fd;
+	ra->dev = st->st_dev;
+	ra->ino = st->st_ino;
+	ra->size = st->st_size;
+	ra->mtime = st->st_mtime;
+	ra->base = cur;
+	ra->start = 0;
+	ra->end = 0;
+}
+
+/**
+ * @brief Replaces the consumed window with the next block of the file
+ *
+ * Uses pread() at the window's end, so the fd offset itself is only
+ * touched once per line, by read_buffered().
+ *
+ * @return ssize_t Bytes now buffered, 0 at EOF, -1 on error
+ */
+ssize_t	read_slot_refill(t_readahead *ra)
+{
+	ssize_t	n;
+
+	ra->base += ra->end;
+	ra->start = 0;
+	ra->end = 0;
+	n = pread(ra->fd, ra->buf, READ_AHEAD_SIZE, ra->base);
+	while (n < 0 && errno == EINTR)
+		n = pread(ra->fd, ra->buf, READ_AHEAD_SIZE, ra->base);
+	if (n > 0)
+		ra->end = n;
+	return (n);
+}
+
+/**
+ * @brief Frees every readahead buffer (for cleanup_shell())
+ */
+void	read_cache_release(void)
+{
+	t_readahead	*slot;
+	int			i;
+
+	i = 0;
+	while (i < READ_CACHE_SLOTS)
+	{
+		slot = read_slot(i);
+		free(slot->buf);
+		slot->buf = NULL;
+		slot->valid = 0;
+		i++;
+	}
+}
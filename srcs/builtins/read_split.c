@@ -0,0 +1,120 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   read_split.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+static int	is_ifs(char c, const char *ifs)
+{
+	return (c && ft_strchr(ifs, c) != NULL);
+}
+
+static int	is_ifs_space(char c, const char *ifs)
+{
+	return ((c == ' ' || c == '\t' || c == '\n') && is_ifs(c, ifs));
+}
+
+/* Copies a field; without -r, each backslash escape becomes its char. */
+static char	*dup_range(const char *start, size_t len, int raw)
+{
+	char	*field;
+	size_t	i;
+	size_t	j;
+
+	field = malloc(len + 1);
+	if (!field)
+		return (NULL);
+	i = 0;
+	j = 0;
+	while (i < len)
+	{
+		if (!raw && start[i] == '\\')
+			i++;
+		if (i < len)
+			field[j++] = start[i];
+		i++;
+	}
+	field[j] = '\0';
+	return (field);
+}
+
+/**
+ * @brief Cuts the next field off *cursor, following IFS rules
+ *
+ * IFS whitespace is trimmed and collapsed; any other IFS character
+ * delimits exactly one field. The last name takes the rest of the line
+ * minus trailing IFS whitespace. Without -r, a backslash-escaped
+ * character never delimits nor gets trimmed; escapes are only resolved
+ * once the field is cut.
+ */
+static char	*next_field(char **cursor, const char *ifs, int raw, int last)
+{
+	char	*p;
+	char	*end;
+	char	*field;
+	size_t	step;
+
+	while (is_ifs_space(**cursor, ifs))
+		(*cursor)++;
+	p = *cursor;
+	end = p;
+	while (*p && (last || !is_ifs(*p, ifs)))
+	{
+		step = 1 + (!raw && p[0] == '\\' && p[1]);
+		if (step == 2 || !is_ifs_space(*p, ifs))
+			end = p + step;
+		p += step;
+	}
+	field = dup_range(*cursor, end - *cursor, raw);
+	*cursor = p;
+	while (is_ifs_space(**cursor, ifs))
+		(*cursor)++;
+	if (**cursor && is_ifs(**cursor, ifs) && !is_ifs_space(**cursor, ifs))
+		(*cursor)++;
+	return (field);
+}
+
+/**
+ * @brief Assigns a line read by `read` to its variable names
+ * @param names NULL-terminated names; empty means the whole line, unsplit
+ *        and untrimmed, to REPLY
+ * @param line The line, trailing newline removed, escapes still in place
+ * @param raw Nonzero for -r: backslashes are ordinary characters
+ * @return int 0 on success, 1 on allocation failure
+ */
+int	read_assign(char **names, char *line, t_shell *shell, int raw)
+{
+	const char	*ifs;
+	char		*field;
+	char		*reply[2];
+	int			i;
+
+	reply[0] = "REPLY";
+	reply[1] = NULL;
+	ifs = ft_getenv("IFS", shell->env);
+	if (!names[0])
+		ifs = "";
+	if (!ifs)
+		ifs = " \t\n";
+	if (!names[0])
+		names = reply;
+	i = 0;
+	while (names[i])
+	{
+		field = next_field(&line, ifs, raw, names[i + 1] == NULL);
+		if (!field)
+			return (EXIT_FAILURE);
+		ft_setenv(names[i], field, &shell->env);
+		free(field);
+		i++;
+	}
+	return (EXIT_SUCCESS);
+}
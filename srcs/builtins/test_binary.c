@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_binary.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#define _GNU_SOURCE
+#include "../../includes/minishell.h"
+
+int	is_binary_op(const char *op)
+{
+	if (!op)
+		return (0);
+	return (ft_strcmp(op, "=") == 0 || ft_strcmp(op, "==") == 0
+		|| ft_strcmp(op, "!=") == 0 || ft_strcmp(op, "<") == 0
+		|| ft_strcmp(op, ">") == 0 || ft_strcmp(op, "-eq") == 0
+		|| ft_strcmp(op, "-ne") == 0 || ft_strcmp(op, "-lt") == 0
+		|| ft_strcmp(op, "-le") == 0 || ft_strcmp(op, "-gt") == 0
+		|| ft_strcmp(op, "-ge") == 0 || ft_strcmp(op, "-nt") == 0
+		|| ft_strcmp(op, "-ot") == 0 || ft_strcmp(op, "-ef") == 0);
+}
+
+/**
+ * @brief Prints "minishell: <name>: [arg: ]msg" and flags the error
+ * @return int EXIT_MISUSE, the status of a malformed test
+ */
+int	test_error(t_test *t, const char *arg, const char *msg)
+{
+	t->err = 1;
+	if (arg)
+		fprintf(stderr, "minishell: %s: %s: %s\n", t->name, arg, msg);
+	else
+		fprintf(stderr, "minishell: %s: %s\n", t->name, msg);
+	return (EXIT_MISUSE);
+}
+
+static int	compare_ints(t_test *t, const char *l, const char *op,
+				const char *r)
+{
+	long long	a;
+	long long	b;
+
+	if (ft_atoll(l, &a) < 0 || ft_atoll(r, &b) < 0)
+	{
+		if (ft_atoll(l, &a) < 0)
+			test_error(t, l, "integer expression expected");
+		else
+			test_error(t, r, "integer expression expected");
+		return (0);
+	}
+	if (ft_strcmp(op, "-eq") == 0)
+		return (a == b);
+	if (ft_strcmp(op, "-ne") == 0)
+		return (a != b);
+	if (ft_strcmp(op, "-lt") == 0)
+		return (a < b);
+	if (ft_strcmp(op, "-le") == 0)
+		return (a <= b);
+	if (ft_strcmp(op, "-gt") == 0)
+		return (a > b);
+	return (a >= b);
+}
+
+static int	compare_files(const char *l, const char *op, const char *r)
+{
+	struct stat	a;
+	struct stat	b;
+	int			has_a;
+	int			has_b;
+
+	has_a = (stat(l, &a) == 0);
+	has_b = (stat(r, &b) == 0);
+	if (ft_strcmp(op, "-ef") == 0)
+		return (has_a && has_b && a.st_dev == b.st_dev
+			&& a.st_ino == b.st_ino);
+	if (ft_strcmp(op, "-nt") == 0)
+		return (has_a && (!has_b || a.st_mtime > b.st_mtime));
+	return (has_b && (!has_a || a.st_mtime < b.st_mtime));
+}
+
+/**
+ * @brief Evaluates `l op r` for string, 64-bit integer and file operators
+ * @return int 1 if true, 0 if false (t->err is set on bad integers)
+ */
+int	eval_binary(t_test *t, const char *l, const char *op, const char *r)
+{
+	if (ft_strcmp(op, "=") == 0 || ft_strcmp(op, "==") == 0)
+		return (ft_strcmp(l, r) == 0);
+	if (ft_strcmp(op, "!=") == 0)
+		return (ft_strcmp(l, r) != 0);
+	if (ft_strcmp(op, "<") == 0)
+		return (ft_strcmp(l, r) < 0);
+	if (ft_strcmp(op, ">") == 0)
+		return (ft_strcmp(l, r) > 0);
+	if (ft_strcmp(op, "-nt") == 0 || ft_strcmp(op, "-ot") == 0
+		|| ft_strcmp(op, "-ef") == 0)
+		return (compare_files(l, op, r));
+	return (compare_ints(t, l, op, r));
+}
@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_parse.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+static int	test_paren(t_test *t)
+{
+	int	result;
+
+	t->pos++;
+	result = test_expr(t);
+	if (t->err)
+		return (0);
+	if (t->pos >= t->argc || ft_strcmp(t->av[t->pos], ")") != 0)
+	{
+		test_error(t, NULL, "`)' expected");
+		return (0);
+	}
+	t->pos++;
+	return (result);
+}
+
+/**
+ * @brief primary := '(' expr ')' | arg binop arg | unop arg | arg
+ */
+static int	test_primary(t_test *t)
+{
+	char	*arg;
+
+	if (t->pos >= t->argc)
+	{
+		test_error(t, NULL, "argument expected");
+		return (0);
+	}
+	arg = t->av[t->pos];
+	if (t->pos + 2 < t->argc && is_binary_op(t->av[t->pos + 1]))
+	{
+		t->pos += 3;
+		return (eval_binary(t, arg, t->av[t->pos - 2], t->av[t->pos - 1]));
+	}
+	if (ft_strcmp(arg, "(") == 0 && t->pos + 1 < t->argc)
+		return (test_paren(t));
+	if (is_unary_op(arg) && t->pos + 1 < t->argc)
+	{
+		t->pos += 2;
+		return (eval_unary(t, arg, t->av[t->pos - 1]));
+	}
+	t->pos++;
+	return (arg[0] != '\0');
+}
+
+/* Consumes a run of `!` iteratively: argv length must not bound the stack. */
+static int	test_not(t_test *t)
+{
+	int	negate;
+
+	negate = 0;
+	while (t->pos + 1 < t->argc && ft_strcmp(t->av[t->pos], "!") == 0)
+	{
+		negate = !negate;
+		t->pos++;
+	}
+	return (test_primary(t) ^ negate);
+}
+
+static int	test_and(t_test *t)
+{
+	int	result;
+
+	result = test_not(t);
+	while (!t->err && t->pos < t->argc
+		&& ft_strcmp(t->av[t->pos], "-a") == 0)
+	{
+		t->pos++;
+		result = test_not(t) && result;
+	}
+	return (result);
+}
+
+/**
+ * @brief expr := and ('-o' and)*, with and := not ('-a' not)*
+ * @return int 1 if true, 0 if false (t->err is set on syntax errors)
+ */
+int	test_expr(t_test *t)
+{
+	int	result;
+
+	result = test_and(t);
+	while (!t->err && t->pos < t->argc
+		&& ft_strcmp(t->av[t->pos], "-o") == 0)
+	{
+		t->pos++;
+		result = test_and(t) || result;
+	}
+	return (result);
+}
@@ -0,0 +1,87 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_unary.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#define _GNU_SOURCE
+#include "../../includes/minishell.h"
+
+int	is_unary_op(const char *op)
+{
+	if (!op || op[0] != '-' || !op[1] || op[2])
+		return (0);
+	return (ft_strchr("bcdefghknprstuwxzLS", op[1]) != NULL);
+}
+
+static int	check_mode(char op, struct stat *st)
+{
+	if (op == 'b')
+		return (S_ISBLK(st->st_mode));
+	if (op == 'c')
+		return (S_ISCHR(st->st_mode));
+	if (op == 'd')
+		return (S_ISDIR(st->st_mode));
+	if (op == 'f')
+		return (S_ISREG(st->st_mode));
+	if (op == 'p')
+		return (S_ISFIFO(st->st_mode));
+	if (op == 'S')
+		return (S_ISSOCK(st->st_mode));
+	if (op == 'g')
+		return ((st->st_mode & S_ISGID) != 0);
+	if (op == 'u')
+		return ((st->st_mode & S_ISUID) != 0);
+	if (op == 'k')
+		return ((st->st_mode & S_ISVTX) != 0);
+	if (op == 's')
+		return (st->st_size > 0);
+	return (1);
+}
+
+static int	file_test(char op, const char *path)
+{
+	struct stat	st;
+
+	if (op == 'h' || op == 'L')
+		return (lstat(path, &st) == 0 && S_ISLNK(st.st_mode));
+	if (op == 'r')
+		return (access(path, R_OK) == 0);
+	if (op == 'w')
+		return (access(path, W_OK) == 0);
+	if (op == 'x')
+		return (access(path, X_OK) == 0);
+	if (stat(path, &st) < 0)
+		return (0);
+	return (check_mode(op, &st));
+}
+
+/**
+ * @brief Evaluates a unary primary such as `-f path` or `-z string`
+ * @return int 1 if true, 0 if false
+ */
+int	eval_unary(t_test *t, const char *op, const char *arg)
+{
+	long long	fd;
+
+	if (op[1] == 'z')
+		return (arg[0] == '\0');
+	if (op[1] == 'n')
+		return (arg[0] != '\0');
+	if (op[1] == 't')
+	{
+		if (ft_atoll(arg, &fd) < 0 || fd < 0 || fd > INT_MAX)
+		{
+			test_error(t, arg, "integer expression expected");
+			return (0);
+		}
+		return (isatty((int)fd));
+	}
+	return (file_test(op[1], arg));
+}
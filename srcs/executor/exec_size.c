@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   exec_size.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#define _GNU_SOURCE
+#include "../../includes/minishell.h"
+#include <limits.h>
+
+#ifdef ARG_MAX
+# define FALLBACK_ARG_MAX ARG_MAX
+#else
+# define FALLBACK_ARG_MAX 131072
+#endif
+
+#ifdef __linux__
+
+/*
+ * Linux additionally caps each single argument or environment string at
+ * 32 pages (MAX_ARG_STRLEN), whatever the total.
+ */
+# define MAX_ARG_STRLEN 131072
+
+static int	string_too_long(size_t len)
+{
+	return (len > MAX_ARG_STRLEN);
+}
+
+#else
+
+static int	string_too_long(size_t len)
+{
+	(void)len;
+	return (0);
+}
+
+#endif
+
+/**
+ * @brief Measures what execve() would copy for a NULL-terminated array
+ * @return size_t Bytes needed, or (size_t)-1 if one string is too long
+ */
+static size_t	block_size(char **strs)
+{
+	size_t	total;
+	size_t	len;
+
+	total = sizeof(char *);
+	while (strs && *strs)
+	{
+		len = ft_strlen(*strs) + 1;
+		if (string_too_long(len))
+			return ((size_t)-1);
+		total += len + sizeof(char *);
+		strs++;
+	}
+	return (total);
+}
+
+static size_t	arg_max(void)
+{
+	long	limit;
+
+	limit = sysconf(_SC_ARG_MAX);
+	if (limit > 0)
+		return ((size_t)limit);
+	return (FALLBACK_ARG_MAX);
+}
+
+/**
+ * @brief Checks that argv and envp fit in the kernel's exec limits
+ *
+ * Called right before execve() so oversized argument lists fail with a
+ * clear message instead of a bare execve() error.
+ *
+ * @param argv Argument vector, argv[0] names the command
+ * @param envp Environment passed to execve()
+ * @return int 0 if the exec can proceed, EXIT_CANNOT_EXECUTE otherwise
+ *         (errno is set to E2BIG)
+ */
+int	check_exec_size(char **argv, char **envp)
+{
+	size_t	args;
+	size_t	env;
+
+	args = block_size(argv);
+	env = block_size(envp);
+	if (args != (size_t)-1 && env != (size_t)-1 && args + env <= arg_max())
+		return (0);
+	errno = E2BIG;
+	if (argv && argv[0])
+		fprintf(stderr, "minishell: %s: %s\n", argv[0], strerror(E2BIG));
+	else
+		fprintf(stderr, "minishell: %s\n", strerror(E2BIG));
+	return (EXIT_CANNOT_EXECUTE);
+}
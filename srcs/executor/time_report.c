@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   time_report.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#define _GNU_SOURCE
+#include "../../includes/minishell.h"
+
+/**
+ * @brief Strips a leading `time` reserved word from a pipeline
+ *
+ * Only the first command of a pipeline can carry the keyword; it then
+ * applies to the whole pipeline.
+ *
+ * @param cmd First command of the pipeline
+ * @return int 1 if the pipeline must be timed, 0 otherwise
+ */
+int	strip_time_keyword(t_cmd *cmd)
+{
+	int	i;
+
+	if (!cmd || !cmd->args || !cmd->args[0]
+		|| ft_strcmp(cmd->args[0], "time") != 0)
+		return (0);
+	free(cmd->args[0]);
+	i = 0;
+	while (cmd->args[i + 1])
+	{
+		cmd->args[i] = cmd->args[i + 1];
+		i++;
+	}
+	cmd->args[i] = NULL;
+	return (1);
+}
+
+static double	tv_seconds(struct timeval *tv)
+{
+	return (tv->tv_sec + tv->tv_usec / 1000000.0);
+}
+
+#ifdef __APPLE__
+
+static long	maxrss_kb(struct rusage *ru)
+{
+	return (ru->ru_maxrss / 1024);
+}
+
+#else
+
+static long	maxrss_kb(struct rusage *ru)
+{
+	return (ru->ru_maxrss);
+}
+
+#endif
+
+static void	print_stage(int index, char *name, t_stage_usage *u,
+				struct timeval *start)
+{
+	if (!name)
+		name = "";
+	fprintf(stderr, "%-5d %-16.16s %9.3f %9.3f %9.3f %10ld %7ld %7ld\n",
+		index, name, tv_seconds(&u->end) - tv_seconds(start),
+		tv_seconds(&u->ru.ru_utime), tv_seconds(&u->ru.ru_stime),
+		maxrss_kb(&u->ru), u->ru.ru_nvcsw, u->ru.ru_nivcsw);
+}
+
+/**
+ * @brief Prints the per-stage resource table for a timed pipeline
+ *
+ * One row per stage: wall-clock time from pipeline start to the stage's
+ * exit, user and system CPU time, peak RSS in KB, voluntary and
+ * involuntary context switches. Written to stderr like bash's `time`.
+ * Stages that were never reaped (pid 0) are skipped.
+ *
+ * @param cmds The pipeline, used for stage names
+ * @param usage Per-stage data filled by wait_children_usage()
+ * @param count Number of stages
+ * @param start Time at which the pipeline was started
+ */
+void	print_time_report(t_cmd *cmds, t_stage_usage *usage, int count,
+			struct timeval *start)
+{
+	struct timeval	now;
+	int				i;
+
+	fprintf(stderr, "%-5s %-16s %9s %9s %9s %10s %7s %7s\n", "stage",
+		"command", "real", "user", "sys", "maxrss_kb", "vcsw", "ivcsw");
+	i = 0;
+	while (i < count && cmds)
+	{
+		if (usage[i].pid > 0 && cmds->args)
+			print_stage(i + 1, cmds->args[0], &usage[i], start);
+		else if (usage[i].pid > 0)
+			print_stage(i + 1, NULL, &usage[i], start);
+		cmds = cmds->next;
+		i++;
+	}
+	gettimeofday(&now, NULL);
+	fprintf(stderr, "%-22s %9.3f\n", "total",
+		tv_seconds(&now) - tv_seconds(start));
+}
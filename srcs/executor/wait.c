@@ -0,0 +1,88 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   wait.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#define _GNU_SOURCE
+#include "../../includes/minishell.h"
+
+static pid_t	wait_stage(pid_t pid, int *status, struct rusage *ru)
+{
+	pid_t	ret;
+
+	ret = wait4(pid, status, 0, ru);
+	while (ret < 0 && errno == EINTR)
+		ret = wait4(pid, status, 0, ru);
+	return (ret);
+}
+
+/**
+ * @brief Stores the wait4() results of one stage, stamped with its end time
+ */
+void	record_stage_usage(t_stage_usage *usage, pid_t pid, int status,
+			struct rusage *ru)
+{
+	usage->pid = pid;
+	usage->status = status;
+	usage->ru = *ru;
+	gettimeofday(&usage->end, NULL);
+}
+
+/**
+ * @brief Waits for every stage of a pipeline, collecting resource usage
+ *
+ * When usage is requested, wait_exit_order() first reaps the stages as
+ * they exit, so each end time is the stage's own and not that of the
+ * slowest stage before it. Any stage it could not watch is then waited
+ * for by pid, in pipeline order. Children forked elsewhere (command
+ * substitutions, background reaping) are never taken from their owners.
+ * Entries of stages that could not be reaped keep a pid of 0.
+ *
+ * @param pids Process IDs of the pipeline stages, in pipeline order
+ * @param count Number of stages
+ * @param usage Array of count entries filled in pipeline order, or NULL
+ * @return int Exit code of the last stage, as $? would report it
+ */
+int	wait_children_usage(pid_t *pids, int count, t_stage_usage *usage)
+{
+	struct rusage	ru;
+	int				status;
+	int				i;
+
+	status = -1;
+	if (usage)
+	{
+		ft_memset(usage, 0, sizeof(*usage) * count);
+		wait_exit_order(pids, count, usage);
+	}
+	i = 0;
+	while (i < count)
+	{
+		status = -1;
+		if (usage && usage[i].pid > 0)
+			status = usage[i].status;
+		else if (pids[i] > 0 && wait_stage(pids[i], &status, &ru) == pids[i]
+			&& usage)
+			record_stage_usage(&usage[i], pids[i], status, &ru);
+		i++;
+	}
+	if (status == -1)
+		return (EXIT_FAILURE);
+	return (status_to_exit_code(status));
+}
+
+/**
+ * @brief Waits for every stage of a pipeline
+ * @return int Exit code of the last stage
+ */
+int	wait_for_children(pid_t *pids, int count)
+{
+	return (wait_children_usage(pids, count, NULL));
+}
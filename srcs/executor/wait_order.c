@@ -0,0 +1,130 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   wait_order.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#define _GNU_SOURCE
+#include "../../includes/minishell.h"
+#ifdef __linux__
+# include <poll.h>
+# include <sys/syscall.h>
+#endif
+
+#ifdef SYS_pidfd_open
+
+static int	open_pidfds(pid_t *pids, int count, struct pollfd *fds)
+{
+	int	opened;
+	int	i;
+
+	opened = 0;
+	i = 0;
+	while (i < count)
+	{
+		fds[i].fd = -1;
+		if (pids[i] > 0)
+			fds[i].fd = (int)syscall(SYS_pidfd_open, pids[i], 0);
+		fds[i].events = POLLIN;
+		fds[i].revents = 0;
+		if (fds[i].fd >= 0)
+			opened++;
+		i++;
+	}
+	return (opened);
+}
+
+static void	close_pidfds(struct pollfd *fds, int count)
+{
+	int	i;
+
+	i = 0;
+	while (i < count)
+	{
+		if (fds[i].fd >= 0)
+			close(fds[i].fd);
+		i++;
+	}
+}
+
+/**
+ * @brief Reaps every stage whose pidfd reported an exit
+ * @return int Number of pidfds closed
+ */
+static int	reap_ready(pid_t *pids, int count, struct pollfd *fds,
+				t_stage_usage *usage)
+{
+	struct rusage	ru;
+	int				status;
+	int				done;
+	int				i;
+
+	done = 0;
+	i = 0;
+	while (i < count)
+	{
+		if (fds[i].fd >= 0 && fds[i].revents)
+		{
+			if (wait4(pids[i], &status, WNOHANG, &ru) == pids[i])
+				record_stage_usage(&usage[i], pids[i], status, &ru);
+			close(fds[i].fd);
+			fds[i].fd = -1;
+			done++;
+		}
+		i++;
+	}
+	return (done);
+}
+
+/**
+ * @brief Reaps pipeline stages in the order they exit
+ *
+ * Each stage gets a pidfd and they are polled together, so a stage is
+ * reaped, and its end time taken, as soon as it exits, even while an
+ * earlier stage is still running. Only the pipeline's own pids are
+ * watched. Stages left unreaped (no pidfd, or poll() failed) keep a
+ * pid of 0 for the in-order pass of wait_children_usage().
+ *
+ * @param pids Process IDs of the pipeline stages, in pipeline order
+ * @param count Number of stages
+ * @param usage Zero-filled array of count entries
+ */
+void	wait_exit_order(pid_t *pids, int count, t_stage_usage *usage)
+{
+	struct pollfd	*fds;
+	int				left;
+
+	fds = malloc(sizeof(*fds) * count);
+	if (!fds)
+		return ;
+	left = open_pidfds(pids, count, fds);
+	while (left > 0)
+	{
+		if (poll(fds, count, -1) < 0 && errno != EINTR)
+			break ;
+		left -= reap_ready(pids, count, fds, usage);
+	}
+	close_pidfds(fds, count);
+	free(fds);
+}
+
+#else
+
+/**
+ * @brief Without pidfds, stages are reaped in pipeline order by
+ *        wait_children_usage()
+ */
+void	wait_exit_order(pid_t *pids, int count, t_stage_usage *usage)
+{
+	(void)pids;
+	(void)count;
+	(void)usage;
+}
+
+#endif
@@ -0,0 +1,161 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+static long long	arith_paren(t_arith *a)
+{
+	long long	value;
+
+	a->i++;
+	if (!arith_enter(a))
+		return (0);
+	value = arith_expr(a);
+	a->depth--;
+	arith_skip_spaces(a);
+	if (a->s[a->i] != ')')
+		return (arith_error(a, "missing `)'"));
+	a->i++;
+	return (value);
+}
+
+/**
+ * @brief unary := ('+' | '-' | '!' | '~') unary | '(' expr ')' | operand
+ */
+static long long	arith_unary(t_arith *a)
+{
+	char		c;
+	long long	value;
+
+	arith_skip_spaces(a);
+	c = a->s[a->i];
+	if (a->err)
+		return (0);
+	if (c == '(')
+		return (arith_paren(a));
+	if (c != '+' && c != '-' && c != '!' && c != '~')
+		return (arith_operand(a));
+	a->i++;
+	if (!arith_enter(a))
+		return (0);
+	value = arith_unary(a);
+	a->depth--;
+	if (c == '-')
+		return ((long long)(0ULL - (unsigned long long)value));
+	if (c == '!')
+		return (!value);
+	if (c == '~')
+		return (~value);
+	return (value);
+}
+
+/**
+ * @brief Precedence climbing over the binary operators
+ *
+ * ** is right-associative, so a chain of them nests one call per
+ * operator and goes through arith_enter() like the other recursions.
+ * The right operand of && and || is parsed with evaluation disabled
+ * when the left one already decides the result.
+ */
+static long long	arith_binary(t_arith *a, int min_prec)
+{
+	long long	lhs;
+	long long	rhs;
+	int			op;
+	int			prec;
+
+	lhs = arith_unary(a);
+	op = arith_peek_op(a, &prec);
+	while (!a->err && op && prec >= min_prec)
+	{
+		a->i += 1 + (op > 0xff);
+		if ((op == ARITH_AND && !lhs) || (op == ARITH_OR && lhs))
+			a->noeval++;
+		if (!arith_enter(a))
+			return (0);
+		rhs = arith_binary(a, prec + (op != ARITH_POW));
+		a->depth--;
+		if ((op == ARITH_AND && !lhs) || (op == ARITH_OR && lhs))
+			a->noeval--;
+		lhs = arith_apply(a, op, lhs, rhs);
+		op = arith_peek_op(a, &prec);
+	}
+	return (lhs);
+}
+
+/**
+ * @brief expr := binary ['?' expr ':' expr]
+ */
+long long	arith_expr(t_arith *a)
+{
+	long long	cond;
+	long long	yes;
+	long long	no;
+
+	cond = arith_binary(a, 1);
+	arith_skip_spaces(a);
+	if (a->err || a->s[a->i] != '?')
+		return (cond);
+	a->i++;
+	if (!arith_enter(a))
+		return (0);
+	a->noeval += !cond;
+	yes = arith_expr(a);
+	a->noeval -= !cond;
+	arith_skip_spaces(a);
+	if (a->err || a->s[a->i] != ':')
+		return (arith_error(a, "`:' expected for conditional expression"));
+	a->i++;
+	a->noeval += !!cond;
+	no = arith_expr(a);
+	a->noeval -= !!cond;
+	a->depth--;
+	if (cond)
+		return (yes);
+	return (no);
+}
+
+/**
+ * @brief Evaluates an arithmetic expression in 64-bit signed integers
+ *
+ * Supports C operator precedence (ternary, logical, bitwise, comparison,
+ * shift, additive, multiplicative, unary), decimal/octal/hex literals and
+ * variables. Overflow wraps around like bash instead of being clamped to
+ * int as ft_atoi/ft_itoa would.
+ *
+ * @param expr The text between "$((" and "))"
+ * @param shell Shell state, used to look up variables
+ * @param out Receives the result
+ * @return int 0 on success, -1 on error (message already printed)
+ */
+int	eval_arith(const char *expr, t_shell *shell, long long *out)
+{
+	t_arith	a;
+
+	a.s = expr;
+	a.i = 0;
+	a.shell = shell;
+	a.err = 0;
+	a.noeval = 0;
+	a.depth = 0;
+	*out = 0;
+	arith_skip_spaces(&a);
+	if (!a.s[a.i])
+		return (0);
+	*out = arith_expr(&a);
+	arith_skip_spaces(&a);
+	if (!a.err && a.s[a.i])
+		arith_error(&a, "syntax error in expression");
+	if (a.err)
+		return (-1);
+	return (0);
+}
@@ -0,0 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith_expand.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+static char	*dup_range(const char *str, size_t len)
+{
+	char	*dup;
+
+	dup = malloc(len + 1);
+	if (!dup)
+		return (NULL);
+	ft_memcpy(dup, str, len);
+	dup[len] = '\0';
+	return (dup);
+}
+
+static int	append_number(t_strbuf *buf, long long value)
+{
+	char	*out;
+	int		ret;
+
+	out = ft_lltoa(value);
+	if (!out)
+		return (-1);
+	ret = strbuf_append(buf, out, ft_strlen(out));
+	free(out);
+	return (ret);
+}
+
+/**
+ * @brief Expands the `$((...))` starting at str[*i] into buf
+ *
+ * Evaluated in-process, so counters no longer need a fork of expr(1).
+ *
+ * @return int 0 on success, -1 on error (exit_status is set to 1),
+ *         1 if the text is not an arithmetic expansion after all
+ */
+int	append_arith(t_strbuf *buf, const char *str, size_t *i, t_shell *shell)
+{
+	long		end;
+	char		*expr;
+	long long	value;
+	int			ret;
+
+	end = find_paren_end(str, *i + 2);
+	if (end < 0 || str[end - 1] != ')' || end - 1 < (long)*i + 3)
+		return (1);
+	expr = dup_range(str + *i + 3, end - 1 - (*i + 3));
+	if (!expr)
+		return (-1);
+	ret = eval_arith(expr, shell, &value);
+	free(expr);
+	if (ret < 0)
+	{
+		shell->exit_status = EXIT_FAILURE;
+		return (-1);
+	}
+	ret = append_number(buf, value);
+	*i = end + 1;
+	return (ret);
+}
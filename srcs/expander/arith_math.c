@@ -0,0 +1,55 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith_math.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+/**
+ * @brief Division and remainder; LLONG_MIN / -1 wraps instead of trapping
+ */
+long long	arith_div(t_arith *a, int op, long long l, long long r)
+{
+	if (a->noeval)
+		return (0);
+	if (r == 0)
+		return (arith_error(a, "division by 0"));
+	if (r == -1 && op == '/')
+		return ((long long)(0ULL - (unsigned long long)l));
+	if (r == -1)
+		return (0);
+	if (op == '/')
+		return (l / r);
+	return (l % r);
+}
+
+/**
+ * @brief Exponentiation by squaring, wrapping on overflow like bash
+ */
+long long	arith_pow(t_arith *a, long long base, long long exp)
+{
+	unsigned long long	result;
+	unsigned long long	factor;
+
+	if (a->noeval)
+		return (0);
+	if (exp < 0)
+		return (arith_error(a, "exponent less than 0"));
+	result = 1;
+	factor = (unsigned long long)base;
+	while (exp > 0)
+	{
+		if (exp & 1)
+			result *= factor;
+		factor *= factor;
+		exp >>= 1;
+	}
+	return ((long long)result);
+}
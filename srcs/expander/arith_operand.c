@@ -0,0 +1,94 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith_operand.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+void	arith_skip_spaces(t_arith *a)
+{
+	while (a->s[a->i] == ' ' || a->s[a->i] == '\t' || a->s[a->i] == '\n')
+		a->i++;
+}
+
+/**
+ * @brief Reports an arithmetic error once, bash style
+ * @return long long Always 0, so callers can return it directly
+ */
+long long	arith_error(t_arith *a, const char *msg)
+{
+	if (a->err)
+		return (0);
+	a->err = 1;
+	fprintf(stderr, "minishell: %s: %s (error token is \"%s\")\n",
+		a->s, msg, a->s + a->i);
+	return (0);
+}
+
+
+static int	digit_value(char c)
+{
+	if (ft_isdigit(c))
+		return (c - '0');
+	if (c >= 'a' && c <= 'z')
+		return (c - 'a' + 10);
+	if (c >= 'A' && c <= 'Z')
+		return (c - 'A' + 10);
+	return (INT_MAX);
+}
+
+/**
+ * @brief Reads a decimal, octal (leading 0) or hex (0x) literal
+ */
+static long long	read_number(t_arith *a)
+{
+	unsigned long long	value;
+	int					base;
+	int					digit;
+
+	base = 10;
+	if (a->s[a->i] == '0' && (a->s[a->i + 1] == 'x' || a->s[a->i + 1] == 'X'))
+	{
+		base = 16;
+		a->i += 2;
+	}
+	else if (a->s[a->i] == '0')
+		base = 8;
+	value = 0;
+	while (ft_isalnum(a->s[a->i]) || a->s[a->i] == '_')
+	{
+		digit = digit_value(a->s[a->i]);
+		if (digit >= base)
+			return (arith_error(a, "value too great for base"));
+		value = value * base + digit;
+		a->i++;
+	}
+	return ((long long)value);
+}
+
+/**
+ * @brief operand := number | name | '$' name
+ */
+long long	arith_operand(t_arith *a)
+{
+	char	c;
+
+	c = a->s[a->i];
+	if (c == '$' && (ft_isalpha(a->s[a->i + 1]) || a->s[a->i + 1] == '_'))
+	{
+		a->i++;
+		c = a->s[a->i];
+	}
+	if (ft_isdigit(c))
+		return (read_number(a));
+	if (ft_isalpha(c) || c == '_')
+		return (arith_variable(a));
+	return (arith_error(a, "syntax error: operand expected"));
+}
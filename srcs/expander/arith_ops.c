@@ -0,0 +1,135 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith_ops.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+static int	op_prec(int op)
+{
+	if (op == ARITH_OR)
+		return (1);
+	if (op == ARITH_AND)
+		return (2);
+	if (op == '|')
+		return (3);
+	if (op == '^')
+		return (4);
+	if (op == '&')
+		return (5);
+	if (op == ARITH_EQ || op == ARITH_NE)
+		return (6);
+	if (op == '<' || op == '>' || op == ARITH_LE || op == ARITH_GE)
+		return (7);
+	if (op == ARITH_SHL || op == ARITH_SHR)
+		return (8);
+	if (op == '+' || op == '-')
+		return (9);
+	if (op == ARITH_POW)
+		return (11);
+	return (10);
+}
+
+/**
+ * @brief Identifies the binary operator at the cursor without consuming it
+ *
+ * Two-character operators are encoded as c1 | c2 << 8 (see ARITH_*).
+ *
+ * @return int The operator, or 0 if none (prec is then left untouched)
+ */
+int	arith_peek_op(t_arith *a, int *prec)
+{
+	int			op;
+	const char	*p;
+
+	arith_skip_spaces(a);
+	p = a->s + a->i;
+	op = 0;
+	if ((p[0] == '|' || p[0] == '&' || p[0] == '<' || p[0] == '>'
+			|| p[0] == '*') && p[1] == p[0])
+		op = p[0] | p[1] << 8;
+	else if ((p[0] == '=' || p[0] == '!' || p[0] == '<' || p[0] == '>')
+		&& p[1] == '=')
+		op = p[0] | p[1] << 8;
+	else if (p[0] && ft_strchr("|^&<>+-*/%", p[0]))
+		op = p[0];
+	if (op)
+		*prec = op_prec(op);
+	return (op);
+}
+
+static long long	apply_logic(int op, long long l, long long r)
+{
+	if (op == '<')
+		return (l < r);
+	if (op == '>')
+		return (l > r);
+	if (op == ARITH_LE)
+		return (l <= r);
+	if (op == ARITH_GE)
+		return (l >= r);
+	if (op == ARITH_EQ)
+		return (l == r);
+	if (op == ARITH_NE)
+		return (l != r);
+	if (op == '&')
+		return (l & r);
+	if (op == '|')
+		return (l | r);
+	if (op == '^')
+		return (l ^ r);
+	if (op == ARITH_AND)
+		return (l && r);
+	return (l || r);
+}
+
+/**
+ * @brief Applies a binary operator with bash's wrap-around semantics
+ */
+long long	arith_apply(t_arith *a, int op, long long l, long long r)
+{
+	unsigned long long	ul;
+	unsigned long long	ur;
+
+	ul = (unsigned long long)l;
+	ur = (unsigned long long)r;
+	if (op == '/' || op == '%')
+		return (arith_div(a, op, l, r));
+	if (op == ARITH_POW)
+		return (arith_pow(a, l, r));
+	if (op == '+')
+		return ((long long)(ul + ur));
+	if (op == '-')
+		return ((long long)(ul - ur));
+	if (op == '*')
+		return ((long long)(ul * ur));
+	if (op == ARITH_SHL)
+		return ((long long)(ul << (ur & 63)));
+	if (op == ARITH_SHR)
+		return (l >> (ur & 63));
+	return (apply_logic(op, l, r));
+}
+
+/**
+ * @brief Enters one level of recursive descent
+ *
+ * Every step that can nest without bound (unary prefixes, `**` chains,
+ * parentheses, ternaries) goes through here, so a hostile expression
+ * fails with an error instead of exhausting the stack.
+ *
+ * @return int 1 to go on, 0 once ARITH_MAX_DEPTH is exceeded (error set)
+ */
+int	arith_enter(t_arith *a)
+{
+	if (++a->depth <= ARITH_MAX_DEPTH)
+		return (1);
+	arith_error(a, "expression recursion level exceeded");
+	return (0);
+}
@@ -0,0 +1,57 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arith_var.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+static char	*lookup(char **env, const char *name, size_t len)
+{
+	while (env && *env)
+	{
+		if (ft_strncmp(*env, name, len) == 0 && (*env)[len] == '=')
+			return (*env + len + 1);
+		env++;
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Reads a variable name and evaluates its value as an expression
+ *
+ * Unset or empty variables count as 0. The value is itself parsed as an
+ * expression, as in bash, with the same recursion limit as parentheses.
+ */
+long long	arith_variable(t_arith *a)
+{
+	size_t		start;
+	char		*value;
+	t_arith		sub;
+	long long	result;
+
+	start = a->i;
+	while (ft_isalnum(a->s[a->i]) || a->s[a->i] == '_')
+		a->i++;
+	value = lookup(a->shell->env, a->s + start, a->i - start);
+	if (!value || !*value)
+		return (0);
+	if (!arith_enter(a))
+		return (0);
+	sub = *a;
+	sub.s = value;
+	sub.i = 0;
+	result = arith_expr(&sub);
+	a->depth--;
+	arith_skip_spaces(&sub);
+	if (!sub.err && sub.s[sub.i])
+		arith_error(&sub, "syntax error in expression");
+	a->err = sub.err;
+	return (result);
+}
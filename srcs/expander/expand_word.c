@@ -0,0 +1,143 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   expand_word.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+/**
+ * @brief Copies a single-quoted span without its quotes
+ */
+static int	append_single(t_strbuf *buf, const char *str, size_t *i)
+{
+	size_t	end;
+
+	end = skip_quoted(str, *i);
+	if (strbuf_append(buf, str + *i + 1, end - *i - 1) < 0)
+		return (-1);
+	*i = end;
+	if (str[end])
+		*i += 1;
+	return (0);
+}
+
+/**
+ * @brief Resolves a backslash: outside quotes it escapes any character,
+ *        inside double quotes only $ ` " \ and newline
+ */
+static int	append_escaped(t_strbuf *buf, const char *str, size_t *i,
+				int in_dquote)
+{
+	char	next;
+
+	next = str[*i + 1];
+	*i += 1;
+	if (!next)
+		return (strbuf_append(buf, "\\", 1));
+	*i += 1;
+	if (in_dquote && !ft_strchr("$`\"\\\n", next))
+		return (strbuf_append(buf, str + *i - 2, 2));
+	if (next == '\n')
+		return (0);
+	return (strbuf_append(buf, &next, 1));
+}
+
+/**
+ * @brief Expands the `$` at str[*i]
+ *
+ * `$((...))` is evaluated by append_arith(). A `$(...)` command
+ * substitution is copied as written, quotes included, until the pipeline
+ * stages it needs are implemented. Any other `$` is literal.
+ */
+static int	append_dollar(t_strbuf *buf, const char *str, size_t *i,
+				t_shell *shell)
+{
+	long	end;
+	int		ret;
+
+	if (str[*i + 1] == '(' && str[*i + 2] == '(')
+	{
+		ret = append_arith(buf, str, i, shell);
+		if (ret != 1)
+			return (ret);
+	}
+	end = -1;
+	if (str[*i + 1] == '(')
+		end = find_paren_end(str, *i + 2);
+	if (end < 0)
+		end = (long)*i;
+	ret = strbuf_append(buf, str + *i, end + 1 - *i);
+	*i = end + 1;
+	return (ret);
+}
+
+/**
+ * @brief Drops a double quote, or copies a run of characters that need
+ *        no expansion
+ */
+static int	append_plain(t_strbuf *buf, const char *str, size_t *i,
+				int *in_dquote)
+{
+	size_t	end;
+
+	if (str[*i] == '"')
+	{
+		*in_dquote = !*in_dquote;
+		*i += 1;
+		return (0);
+	}
+	end = *i + 1;
+	while (str[end] && !ft_strchr("\"\\$", str[end])
+		&& (*in_dquote || str[end] != '\''))
+		end++;
+	if (strbuf_append(buf, str + *i, end - *i) < 0)
+		return (-1);
+	*i = end;
+	return (0);
+}
+
+/**
+ * @brief Expands `$((...))` in a word and removes its quotes
+ *
+ * Both happen in one pass, so the text an expansion produces goes into
+ * a word whose quotes are already gone: quotes or backslashes in it are
+ * kept as they are instead of being taken for shell quoting.
+ *
+ * @param str The word to expand, not NULL (not freed)
+ * @param shell Shell state, exit_status is set to 1 on arithmetic errors
+ * @return char* Newly allocated expanded word, or NULL on failure
+ */
+char	*expand_word(const char *str, t_shell *shell)
+{
+	t_strbuf	buf;
+	size_t		i;
+	int			in_dquote;
+	int			ret;
+
+	strbuf_init(&buf);
+	in_dquote = 0;
+	ret = 0;
+	i = 0;
+	while (ret >= 0 && str[i])
+	{
+		if (str[i] == '\'' && !in_dquote)
+			ret = append_single(&buf, str, &i);
+		else if (str[i] == '\\')
+			ret = append_escaped(&buf, str, &i, in_dquote);
+		else if (str[i] == '$')
+			ret = append_dollar(&buf, str, &i, shell);
+		else
+			ret = append_plain(&buf, str, &i, &in_dquote);
+	}
+	if (ret >= 0)
+		return (strbuf_release(&buf));
+	strbuf_free(&buf);
+	return (NULL);
+}
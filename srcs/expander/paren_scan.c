@@ -0,0 +1,59 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   paren_scan.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+/**
+ * @brief Skips a quoted section starting at str[i]
+ * @return size_t Index of the closing quote, or of the terminator
+ */
+size_t	skip_quoted(const char *str, size_t i)
+{
+	char	quote;
+
+	quote = str[i++];
+	while (str[i] && str[i] != quote)
+	{
+		if (quote == '"' && str[i] == '\\' && str[i + 1])
+			i++;
+		i++;
+	}
+	return (i);
+}
+
+/**
+ * @brief Finds the parenthesis closing a substitution body
+ * @param str The string being expanded
+ * @param i Index of the first character of the body (after "$(")
+ * @return long Index of the matching ')', or -1 if unterminated
+ */
+long	find_paren_end(const char *str, size_t i)
+{
+	int	depth;
+
+	depth = 1;
+	while (str[i])
+	{
+		if (str[i] == '\'' || str[i] == '"')
+			i = skip_quoted(str, i);
+		else if (str[i] == '\\' && str[i + 1])
+			i++;
+		else if (str[i] == '(')
+			depth++;
+		else if (str[i] == ')' && --depth == 0)
+			return ((long)i);
+		if (!str[i])
+			break ;
+		i++;
+	}
+	return (-1);
+}
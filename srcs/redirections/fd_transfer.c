@@ -0,0 +1,166 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fd_transfer.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#define _GNU_SOURCE
+#include "../../includes/minishell.h"
+#ifdef __linux__
+# include <sys/sendfile.h>
+#endif
+
+#define XFER_RW 0
+#define XFER_COPY_RANGE 1
+#define XFER_SPLICE 2
+#define XFER_SENDFILE 3
+
+/**
+ * @brief Writes the whole buffer, retrying on short writes and EINTR
+ */
+static int	write_all(int fd, const char *buf, ssize_t len)
+{
+	ssize_t	n;
+
+	while (len > 0)
+	{
+		n = write(fd, buf, len);
+		if (n < 0 && errno == EINTR)
+			continue ;
+		if (n < 0)
+			return (-1);
+		buf += n;
+		len -= n;
+	}
+	return (0);
+}
+
+/**
+ * @brief Portable fallback: large-buffer read/write loop through user space
+ */
+static ssize_t	transfer_rw(int in_fd, int out_fd, ssize_t done)
+{
+	char	*buf;
+	ssize_t	n;
+
+	buf = malloc(FD_TRANSFER_BUF);
+	if (!buf)
+		return (-1);
+	while (1)
+	{
+		n = read(in_fd, buf, FD_TRANSFER_BUF);
+		if (n < 0 && errno == EINTR)
+			continue ;
+		if (n <= 0 || write_all(out_fd, buf, n) < 0)
+			break ;
+		done += n;
+	}
+	free(buf);
+	if (n < 0)
+		return (-1);
+	return (done);
+}
+
+#ifdef __linux__
+
+/**
+ * @brief Picks the cheapest kernel-side copy primitive for an fd pair
+ *
+ * copy_file_range() between regular files (may reflink or stay in the
+ * page cache), splice() when either end is a pipe, sendfile() when the
+ * source is a regular file, and the read/write loop otherwise.
+ */
+static int	pick_mode(int in_fd, int out_fd)
+{
+	struct stat	in_st;
+	struct stat	out_st;
+
+	if (fstat(in_fd, &in_st) < 0 || fstat(out_fd, &out_st) < 0)
+		return (XFER_RW);
+	if (S_ISREG(in_st.st_mode) && S_ISREG(out_st.st_mode))
+		return (XFER_COPY_RANGE);
+	if (S_ISFIFO(in_st.st_mode) || S_ISFIFO(out_st.st_mode))
+		return (XFER_SPLICE);
+	if (S_ISREG(in_st.st_mode))
+		return (XFER_SENDFILE);
+	return (XFER_RW);
+}
+
+/**
+ * @brief Runs one kernel copy primitive until EOF
+ *
+ * Returns -2 when the primitive is not usable for this fd pair so the
+ * caller can resume with the read/write loop from the current offsets.
+ */
+static ssize_t	transfer_kernel(int in, int out, int mode, ssize_t *done)
+{
+	ssize_t	n;
+
+	while (1)
+	{
+		if (mode == XFER_COPY_RANGE)
+			n = copy_file_range(in, NULL, out, NULL, FD_TRANSFER_BUF, 0);
+		else if (mode == XFER_SPLICE)
+			n = splice(in, NULL, out, NULL, FD_TRANSFER_BUF,
+					SPLICE_F_MOVE | SPLICE_F_MORE);
+		else
+			n = sendfile(out, in, NULL, FD_TRANSFER_BUF);
+		if (n < 0 && errno == EINTR)
+			continue ;
+		if (n <= 0)
+			break ;
+		*done += n;
+	}
+	if (n < 0 && (errno == EINVAL || errno == ENOSYS || errno == EXDEV
+			|| errno == EOPNOTSUPP || errno == EBADF))
+		return (-2);
+	if (n < 0)
+		return (-1);
+	return (*done);
+}
+
+/**
+ * @brief Moves all remaining data from in_fd to out_fd
+ *
+ * Used by heredoc delivery and redirections whenever bulk data has to
+ * cross between descriptors. The kernel primitives avoid copying the
+ * payload through user space; the read/write loop takes over whenever
+ * they are unavailable or refuse the fd pair.
+ *
+ * @param in_fd Source descriptor, read from its current offset
+ * @param out_fd Destination descriptor, written at its current offset
+ * @return ssize_t Number of bytes moved, or -1 on error (errno is set)
+ */
+ssize_t	fd_transfer(int in_fd, int out_fd)
+{
+	ssize_t	done;
+	ssize_t	ret;
+	int		mode;
+
+	done = 0;
+	mode = pick_mode(in_fd, out_fd);
+	if (mode != XFER_RW)
+	{
+		ret = transfer_kernel(in_fd, out_fd, mode, &done);
+		if (ret == -2 && mode == XFER_COPY_RANGE)
+			ret = transfer_kernel(in_fd, out_fd, XFER_SENDFILE, &done);
+		if (ret != -2)
+			return (ret);
+	}
+	return (transfer_rw(in_fd, out_fd, done));
+}
+
+#else
+
+ssize_t	fd_transfer(int in_fd, int out_fd)
+{
+	return (transfer_rw(in_fd, out_fd, 0));
+}
+
+#endif
@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   event_loop.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+#include <poll.h>
+
+typedef struct s_line_state
+{
+	char	*line;
+	int		done;
+}	t_line_state;
+
+static t_line_state	*line_state(void)
+{
+	static t_line_state	state;
+
+	return (&state);
+}
+
+/**
+ * @brief readline callback, invoked once a full line (or EOF) is read
+ */
+static void	on_line(char *line)
+{
+	line_state()->line = line;
+	line_state()->done = 1;
+	rl_callback_handler_remove();
+}
+
+/**
+ * @brief Handles one signal read from the signal descriptor
+ *
+ * SIGINT drops the line being edited: at the prompt a fresh prompt is
+ * drawn, in heredoc mode the whole input is cancelled. SIGQUIT is
+ * ignored and SIGCHLD reaps finished children.
+ *
+ * @return int 1 if the current read must be cancelled, 0 otherwise
+ */
+static int	on_signal(t_shell *shell, int sig, int mode)
+{
+	if (sig == SIGCHLD)
+		reap_children(shell);
+	if (sig != SIGINT)
+		return (0);
+	shell->exit_status = 130;
+	write(STDOUT_FILENO, "\n", 1);
+	rl_replace_line("", 0);
+	if (mode == LINE_HEREDOC)
+	{
+		shell->interrupted = 1;
+		rl_callback_handler_remove();
+		return (1);
+	}
+	rl_on_new_line();
+	rl_redisplay();
+	return (0);
+}
+
+static int	dispatch_signals(t_shell *shell, int mode)
+{
+	int	sig;
+
+	sig = signals_next(shell->sig_fd);
+	while (sig)
+	{
+		if (on_signal(shell, sig, mode))
+			return (1);
+		sig = signals_next(shell->sig_fd);
+	}
+	return (0);
+}
+
+/**
+ * @brief Event-driven replacement for readline()
+ *
+ * Multiplexes stdin and the signal descriptor with poll() and feeds
+ * readline one character at a time through its callback interface, so
+ * signals are handled between keystrokes rather than inside them.
+ * Signals queued before the prompt is drawn are dropped first.
+ *
+ * @param shell Shell state (sig_fd, exit_status, interrupted)
+ * @param prompt Prompt to display
+ * @param mode LINE_PROMPT or LINE_HEREDOC
+ * @return char* The line read (caller frees), or NULL on EOF or when a
+ *         heredoc was cancelled with Ctrl-C (shell->interrupted is set)
+ */
+char	*shell_readline(t_shell *shell, const char *prompt, int mode)
+{
+	struct pollfd	fds[2];
+
+	line_state()->line = NULL;
+	line_state()->done = 0;
+	shell->interrupted = 0;
+	discard_pending_signals(shell);
+	rl_callback_handler_install(prompt, on_line);
+	fds[0].fd = STDIN_FILENO;
+	fds[0].events = POLLIN;
+	fds[1].fd = shell->sig_fd;
+	fds[1].events = POLLIN;
+	while (!line_state()->done)
+	{
+		if (poll(fds, 2, -1) < 0 && errno != EINTR)
+			break ;
+		if ((fds[1].revents & POLLIN) && dispatch_signals(shell, mode))
+			return (NULL);
+		if (fds[0].revents & (POLLIN | POLLHUP))
+			rl_callback_read_char();
+	}
+	return (line_state()->line);
+}
@@ -0,0 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   reap.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+/**
+ * @brief Converts a wait() status into a shell exit status
+ * @return int The exit code, or 128 + signal number for killed children
+ */
+int	status_to_exit_code(int status)
+{
+	if (WIFEXITED(status))
+		return (WEXITSTATUS(status));
+	if (WIFSIGNALED(status))
+		return (128 + WTERMSIG(status));
+	return (EXIT_FAILURE);
+}
+
+/**
+ * @brief Reaps every child that has already terminated
+ *
+ * Called when SIGCHLD is read from the signal descriptor, so exit
+ * statuses are collected as soon as the event arrives, without polling.
+ *
+ * @param shell Shell state, exit_status is updated for each reaped child
+ */
+void	reap_children(t_shell *shell)
+{
+	pid_t	pid;
+	int		status;
+
+	pid = waitpid(-1, &status, WNOHANG);
+	while (pid > 0)
+	{
+		shell->exit_status = status_to_exit_code(status);
+		pid = waitpid(-1, &status, WNOHANG);
+	}
+}
+
+/**
+ * @brief Drops signals left over from a foreground job
+ *
+ * SIGINT stays blocked while a child runs in the foreground, so a
+ * Ctrl-C meant for the child is still queued on the signal descriptor
+ * when the prompt comes back. Replaying it would draw an extra prompt
+ * and force $? to 130; it is discarded instead. Pending SIGCHLD events
+ * are still honoured.
+ *
+ * @param shell Shell state (sig_fd, exit_status)
+ */
+void	discard_pending_signals(t_shell *shell)
+{
+	int	sig;
+
+	sig = signals_next(shell->sig_fd);
+	while (sig)
+	{
+		if (sig == SIGCHLD)
+			reap_children(shell);
+		sig = signals_next(shell->sig_fd);
+	}
+}
@@ -0,0 +1,143 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   signals.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#define _GNU_SOURCE
+#include "../../includes/minishell.h"
+#ifdef __linux__
+# include <sys/signalfd.h>
+#endif
+
+static void	fill_mask(sigset_t *mask)
+{
+	sigemptyset(mask);
+	sigaddset(mask, SIGINT);
+	sigaddset(mask, SIGQUIT);
+	sigaddset(mask, SIGCHLD);
+}
+
+#ifdef __linux__
+
+/**
+ * @brief Turns SIGINT/SIGQUIT/SIGCHLD into readable events on one fd
+ *
+ * The signals are blocked and delivered through a signalfd, so they are
+ * consumed synchronously by the event loop instead of interrupting
+ * arbitrary code: no async handlers, no EINTR races with readline.
+ *
+ * @param shell Shell state, receives the descriptor in sig_fd
+ * @return int 0 on success, -1 on failure (the signal mask is restored)
+ */
+int	signals_init(t_shell *shell)
+{
+	sigset_t	mask;
+	sigset_t	old;
+
+	fill_mask(&mask);
+	if (sigprocmask(SIG_BLOCK, &mask, &old) < 0)
+		return (-1);
+	shell->sig_fd = signalfd(-1, &mask, SFD_NONBLOCK | SFD_CLOEXEC);
+	if (shell->sig_fd < 0)
+	{
+		sigprocmask(SIG_SETMASK, &old, NULL);
+		return (-1);
+	}
+	return (0);
+}
+
+/**
+ * @brief Pops the next pending signal from the signal descriptor
+ * @return int The signal number, or 0 when nothing is pending
+ */
+int	signals_next(int sig_fd)
+{
+	struct signalfd_siginfo	info;
+
+	if (read(sig_fd, &info, sizeof(info)) != sizeof(info))
+		return (0);
+	return ((int)info.ssi_signo);
+}
+
+#else
+
+static int	*self_pipe(void)
+{
+	static int	fds[2] = {-1, -1};
+
+	return (fds);
+}
+
+/**
+ * @brief Self-pipe fallback for systems without signalfd
+ *
+ * The only async work is one write() of the signal number, which is
+ * async-signal-safe; everything else happens in the event loop.
+ */
+static void	forward_signal(int sig)
+{
+	unsigned char	byte;
+	int				saved_errno;
+
+	saved_errno = errno;
+	byte = (unsigned char)sig;
+	write(self_pipe()[1], &byte, 1);
+	errno = saved_errno;
+}
+
+int	signals_init(t_shell *shell)
+{
+	struct sigaction	sa;
+	int					*fds;
+
+	fds = self_pipe();
+	if (pipe(fds) < 0)
+		return (-1);
+	fcntl(fds[0], F_SETFL, O_NONBLOCK);
+	fcntl(fds[1], F_SETFL, O_NONBLOCK);
+	fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+	fcntl(fds[1], F_SETFD, FD_CLOEXEC);
+	sa.sa_handler = forward_signal;
+	sa.sa_flags = SA_RESTART;
+	fill_mask(&sa.sa_mask);
+	sigaction(SIGINT, &sa, NULL);
+	sigaction(SIGQUIT, &sa, NULL);
+	sigaction(SIGCHLD, &sa, NULL);
+	shell->sig_fd = fds[0];
+	return (0);
+}
+
+int	signals_next(int sig_fd)
+{
+	unsigned char	byte;
+
+	if (read(sig_fd, &byte, 1) != 1)
+		return (0);
+	return ((int)byte);
+}
+
+#endif
+
+/**
+ * @brief Restores default signal behaviour in a freshly forked child
+ *
+ * Must be called before execve(): blocked masks and handlers would
+ * otherwise be inherited by the executed program.
+ */
+void	signals_reset_child(void)
+{
+	sigset_t	mask;
+
+	signal(SIGINT, SIG_DFL);
+	signal(SIGQUIT, SIG_DFL);
+	signal(SIGCHLD, SIG_DFL);
+	fill_mask(&mask);
+	sigprocmask(SIG_UNBLOCK, &mask, NULL);
+}
@@ -10,7 +10,7 @@
 /*                                                                            */
 /* ************************************************************************** */
 
-#include "../../Includes/minishell.h"
+#include "../../includes/minishell.h"
 
 int	ft_isdigit(int c)
 {
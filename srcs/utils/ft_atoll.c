@@ -0,0 +1,69 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_atoll.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+static int	ft_isspace(int c)
+{
+	return (c == ' ' || c == '\t' || c == '\n'
+		|| c == '\v' || c == '\f' || c == '\r');
+}
+
+/* Accumulates negatively so LLONG_MIN parses without overflow. */
+static int	accumulate(const char *str, int *i, int sign, long long *out)
+{
+	long long	acc;
+	int			digit;
+
+	acc = 0;
+	while (ft_isdigit(str[*i]))
+	{
+		digit = str[(*i)++] - '0';
+		if (acc < (LLONG_MIN + digit) / 10)
+			return (-1);
+		acc = acc * 10 - digit;
+	}
+	if (sign > 0 && acc == LLONG_MIN)
+		return (-1);
+	if (sign > 0)
+		acc = -acc;
+	*out = acc;
+	return (0);
+}
+
+/*
+ * Strict 64-bit conversion: the whole string must be one integer,
+ * optionally surrounded by whitespace. Returns -1 on garbage or overflow.
+ */
+int	ft_atoll(const char *str, long long *out)
+{
+	int	sign;
+	int	i;
+
+	if (!str)
+		return (-1);
+	i = 0;
+	sign = 1;
+	while (ft_isspace(str[i]))
+		i++;
+	if (str[i] == '-')
+		sign = -1;
+	if (str[i] == '-' || str[i] == '+')
+		i++;
+	if (!ft_isdigit(str[i]) || accumulate(str, &i, sign, out) < 0)
+		return (-1);
+	while (ft_isspace(str[i]))
+		i++;
+	if (str[i])
+		return (-1);
+	return (0);
+}
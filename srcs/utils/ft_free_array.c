@@ -10,7 +10,7 @@
 /*                                                                            */
 /* ************************************************************************** */
 
-#include "../../Includes/minishell.h"
+#include "../../includes/minishell.h"
 
 void	ft_free_array(char **array)
 {
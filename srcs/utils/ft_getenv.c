@@ -0,0 +1,30 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_getenv.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+/* Returns a pointer into env (not a copy), or NULL if name is unset. */
+char	*ft_getenv(const char *name, char **env)
+{
+	size_t	len;
+
+	if (!name || !env)
+		return (NULL);
+	len = ft_strlen(name);
+	while (*env)
+	{
+		if (ft_strncmp(*env, name, len) == 0 && (*env)[len] == '=')
+			return (*env + len + 1);
+		env++;
+	}
+	return (NULL);
+}
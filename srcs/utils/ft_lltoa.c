@@ -0,0 +1,52 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_lltoa.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+static int	count_digits(unsigned long long n)
+{
+	int	count;
+
+	count = 1;
+	while (n >= 10)
+	{
+		n /= 10;
+		count++;
+	}
+	return (count);
+}
+
+char	*ft_lltoa(long long n)
+{
+	char				*result;
+	unsigned long long	mag;
+	int					len;
+
+	mag = (unsigned long long)n;
+	if (n < 0)
+		mag = -mag;
+	len = count_digits(mag) + (n < 0);
+	result = malloc(sizeof(char) * (len + 1));
+	if (!result)
+		return (NULL);
+	result[len] = '\0';
+	while (len > 0)
+	{
+		result[--len] = (mag % 10) + '0';
+		mag /= 10;
+		if (mag == 0)
+			break ;
+	}
+	if (n < 0)
+		result[0] = '-';
+	return (result);
+}
@@ -10,7 +10,7 @@
 /*                                                                            */
 /* ************************************************************************** */
 
-#include "../../Includes/minishell.h"
+#include "../../includes/minishell.h"
 
 void	*ft_memcpy(void *dst, const void *src, size_t n)
 {
@@ -0,0 +1,68 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_setenv.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+static char	*make_entry(const char *name, const char *value)
+{
+	char	*prefix;
+	char	*entry;
+
+	prefix = ft_strjoin(name, "=");
+	if (!prefix)
+		return (NULL);
+	entry = ft_strjoin(prefix, value);
+	free(prefix);
+	return (entry);
+}
+
+static void	append_entry(char ***env, char *entry, size_t count)
+{
+	char	**grown;
+
+	grown = malloc(sizeof(char *) * (count + 2));
+	if (!grown)
+	{
+		free(entry);
+		return ;
+	}
+	ft_memcpy(grown, *env, sizeof(char *) * count);
+	grown[count] = entry;
+	grown[count + 1] = NULL;
+	free(*env);
+	*env = grown;
+}
+
+/* env must be a malloc'd array of malloc'd strings (see copy_env). */
+void	ft_setenv(const char *name, const char *value, char ***env)
+{
+	char	*entry;
+	size_t	len;
+	size_t	i;
+
+	entry = make_entry(name, value);
+	if (!entry)
+		return ;
+	len = ft_strlen(name);
+	i = 0;
+	while (*env && (*env)[i])
+	{
+		if (ft_strncmp((*env)[i], name, len) == 0 && (*env)[i][len] == '=')
+		{
+			free((*env)[i]);
+			(*env)[i] = entry;
+			return ;
+		}
+		i++;
+	}
+	append_entry(env, entry, i);
+}
@@ -0,0 +1,72 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_strbuf.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+void	strbuf_init(t_strbuf *buf)
+{
+	buf->data = NULL;
+	buf->len = 0;
+	buf->cap = 0;
+}
+
+/* Ensures room for extra bytes plus the terminator, doubling capacity. */
+int	strbuf_reserve(t_strbuf *buf, size_t extra)
+{
+	char	*data;
+	size_t	cap;
+
+	if (buf->data && buf->len + extra < buf->cap)
+		return (0);
+	cap = buf->cap;
+	if (cap < BUF_MIN_CAP)
+		cap = BUF_MIN_CAP;
+	while (cap <= buf->len + extra)
+		cap *= 2;
+	data = malloc(cap);
+	if (!data)
+		return (-1);
+	ft_memcpy(data, buf->data, buf->len);
+	data[buf->len] = '\0';
+	free(buf->data);
+	buf->data = data;
+	buf->cap = cap;
+	return (0);
+}
+
+int	strbuf_append(t_strbuf *buf, const char *str, size_t n)
+{
+	if (strbuf_reserve(buf, n) < 0)
+		return (-1);
+	ft_memcpy(buf->data + buf->len, str, n);
+	buf->len += n;
+	buf->data[buf->len] = '\0';
+	return (0);
+}
+
+/* Hands the NUL-terminated string to the caller and resets the buffer. */
+char	*strbuf_release(t_strbuf *buf)
+{
+	char	*data;
+
+	if (strbuf_reserve(buf, 0) < 0)
+		return (NULL);
+	data = buf->data;
+	strbuf_init(buf);
+	return (data);
+}
+
+void	strbuf_free(t_strbuf *buf)
+{
+	free(buf->data);
+	strbuf_init(buf);
+}
@@ -0,0 +1,72 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_strvec.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+void	strvec_init(t_strvec *vec)
+{
+	vec->data = NULL;
+	vec->len = 0;
+	vec->cap = 0;
+}
+
+/* Capacity doubles, so n pushes cost O(n) copies overall. */
+static int	strvec_grow(t_strvec *vec)
+{
+	char	**data;
+	size_t	cap;
+
+	cap = vec->cap * 2;
+	if (cap < VEC_MIN_CAP)
+		cap = VEC_MIN_CAP;
+	data = malloc(sizeof(char *) * (cap + 1));
+	if (!data)
+		return (-1);
+	ft_memcpy(data, vec->data, sizeof(char *) * vec->len);
+	free(vec->data);
+	vec->data = data;
+	vec->cap = cap;
+	return (0);
+}
+
+/* Takes ownership of str. The array stays NULL-terminated. */
+int	strvec_push(t_strvec *vec, char *str)
+{
+	if (vec->len == vec->cap && strvec_grow(vec) < 0)
+		return (-1);
+	vec->data[vec->len++] = str;
+	vec->data[vec->len] = NULL;
+	return (0);
+}
+
+/* Hands the NULL-terminated array to the caller and resets the vector. */
+char	**strvec_release(t_strvec *vec)
+{
+	char	**data;
+
+	if (!vec->data && strvec_grow(vec) < 0)
+		return (NULL);
+	data = vec->data;
+	data[vec->len] = NULL;
+	strvec_init(vec);
+	return (data);
+}
+
+void	strvec_free(t_strvec *vec)
+{
+	if (vec->data)
+	{
+		vec->data[vec->len] = NULL;
+		ft_free_array(vec->data);
+	}
+	strvec_init(vec);
+}
@@ -0,0 +1,55 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fuzz_expand.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+/*
+ * libFuzzer entry over the arithmetic evaluator and the word-expansion
+ * scanner: `make fuzz`, then `./fuzz_expand [corpus_dir]`.
+ */
+
+int	LLVMFuzzerInitialize(int *argc, char ***argv)
+{
+	int	null_fd;
+
+	(void)argc;
+	(void)argv;
+	null_fd = open("/dev/null", O_WRONLY);
+	if (null_fd >= 0)
+	{
+		dup2(null_fd, STDERR_FILENO);
+		close(null_fd);
+	}
+	return (0);
+}
+
+int	LLVMFuzzerTestOneInput(const unsigned char *data, size_t size)
+{
+	static char	*env[] = {"X=5", "Y=X * 2", "Z=Z + 1", NULL};
+	t_shell		shell;
+	char		*input;
+	char		*out;
+	long long	value;
+
+	input = malloc(size + 1);
+	if (!input)
+		return (0);
+	ft_memcpy(input, data, size);
+	input[size] = '\0';
+	ft_memset(&shell, 0, sizeof(shell));
+	shell.env = env;
+	eval_arith(input, &shell, &value);
+	out = expand_word(input, &shell);
+	free(out);
+	free(input);
+	return (0);
+}
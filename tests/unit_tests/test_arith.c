@@ -0,0 +1,61 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_arith.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "tests.h"
+
+static int	eval(const char *expr, long long *value)
+{
+	t_shell	shell;
+	char	*env[4];
+
+	env[0] = "X=5";
+	env[1] = "Y=X * 2";
+	env[2] = "EMPTY=";
+	env[3] = NULL;
+	ft_memset(&shell, 0, sizeof(shell));
+	shell.env = env;
+	return (eval_arith(expr, &shell, value));
+}
+
+static int	arith_is(const char *expr, long long expected)
+{
+	long long	value;
+
+	return (expect(eval(expr, &value) == 0 && value == expected, expr));
+}
+
+/**
+ * @brief eval_arith(): 64-bit wraparound, literals, precedence,
+ *        short-circuit evaluation and variables
+ */
+int	test_arith(void)
+{
+	int	failed;
+
+	failed = arith_is("", 0) + arith_is("  7  ", 7);
+	failed += arith_is("9223372036854775807 + 1", LLONG_MIN);
+	failed += arith_is("-9223372036854775807 - 2", LLONG_MAX);
+	failed += arith_is("9223372036854775807 * 2", -2);
+	failed += arith_is("(-9223372036854775807 - 1) / -1", LLONG_MIN);
+	failed += arith_is("(-9223372036854775807 - 1) % -1", 0);
+	failed += arith_is("010", 8) + arith_is("0x1F", 31) + arith_is("0X10", 16);
+	failed += arith_is("2 + 3 * 4", 14) + arith_is("(2 + 3) * 4", 20);
+	failed += arith_is("2 ** 3 ** 2", 512) + arith_is("-7 / 2", -3);
+	failed += arith_is("-7 % 3", -1) + arith_is("1 << 62 >> 60", 4);
+	failed += arith_is("~0", -1) + arith_is("!5", 0) + arith_is("- -3", 3);
+	failed += arith_is("3 > 2 && 2 >= 2 && 1 != 2", 1);
+	failed += arith_is("6 & 3 | 8 ^ 1", 11);
+	failed += arith_is("0 && 1 / 0", 0) + arith_is("1 || 1 / 0", 1);
+	failed += arith_is("1 ? 2 : 1 / 0", 2) + arith_is("0 ? 1 / 0 : 3", 3);
+	failed += arith_is("X + Y", 15) + arith_is("EMPTY + UNSET + 1", 1);
+	return (failed);
+}
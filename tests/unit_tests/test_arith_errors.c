@@ -0,0 +1,79 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_arith_errors.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "tests.h"
+
+/* expr is copied to the heap so sanitizers catch reads past its end. */
+static int	arith_fails(const char *expr, const char *what)
+{
+	t_shell		shell;
+	long long	value;
+	char		*copy;
+	int			saved;
+	int			ret;
+
+	copy = ft_strdup(expr);
+	if (!copy)
+		return (expect(0, "ft_strdup"));
+	ft_memset(&shell, 0, sizeof(shell));
+	saved = mute_stderr();
+	ret = eval_arith(copy, &shell, &value);
+	unmute_stderr(saved);
+	free(copy);
+	return (expect(ret < 0, what));
+}
+
+/* Builds prefix repeated count times in front of tail. */
+static char	*repeat(const char *prefix, int count, const char *tail)
+{
+	t_strbuf	buf;
+
+	strbuf_init(&buf);
+	while (count-- > 0)
+		if (strbuf_append(&buf, prefix, ft_strlen(prefix)) < 0)
+			break ;
+	if (strbuf_append(&buf, tail, ft_strlen(tail)) < 0)
+		strbuf_free(&buf);
+	return (strbuf_release(&buf));
+}
+
+static int	deep_fails(const char *prefix, int count, const char *tail)
+{
+	char	*expr;
+	int		failed;
+
+	expr = repeat(prefix, count, tail);
+	if (!expr)
+		return (expect(0, "repeat() allocation"));
+	failed = arith_fails(expr, prefix);
+	free(expr);
+	return (failed);
+}
+
+/**
+ * @brief eval_arith(): syntax and math errors, and recursion limits on
+ *        hostile input
+ */
+int	test_arith_errors(void)
+{
+	int	failed;
+
+	failed = arith_fails("1 / 0", "division by zero");
+	failed += arith_fails("08", "invalid octal digit");
+	failed += arith_fails("1 +", "missing operand") + arith_fails("1 ? 2", ":");
+	failed += arith_fails("1 ? 1 +", "error in the middle of ?:");
+	failed += arith_fails("(1", "missing )") + arith_fails("1 2", "junk");
+	failed += deep_fails("!", 5000000, "0") + deep_fails("-", 100000, "1");
+	failed += deep_fails("(", 100000, "1") + deep_fails("2**", 100000, "1");
+	failed += deep_fails("1?", 100000, "1");
+	return (failed);
+}
@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_builtin_test.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "tests.h"
+
+/* Runs `test` (or `[` when line starts with it) on a space-split line. */
+static int	run_test(const char *line)
+{
+	char	**args;
+	int		saved;
+	int		ret;
+
+	args = ft_split(line, ' ');
+	if (!args)
+		return (-1);
+	saved = mute_stderr();
+	ret = builtin_test(args);
+	unmute_stderr(saved);
+	ft_free_array(args);
+	return (ret);
+}
+
+static int	test_is(const char *line, int expected)
+{
+	return (expect(run_test(line) == expected, line));
+}
+
+/* `test` with argument lists ft_split() cannot build (empty strings). */
+static int	test_empty_strings(void)
+{
+	char	*none[3];
+	char	*not_empty[4];
+
+	none[0] = "test";
+	none[1] = "";
+	none[2] = NULL;
+	not_empty[0] = "test";
+	not_empty[1] = "!";
+	not_empty[2] = "";
+	not_empty[3] = NULL;
+	return (expect(builtin_test(none) == 1, "test \"\"")
+		+ expect(builtin_test(not_empty) == 0, "test ! \"\""));
+}
+
+static int	test_many_negations(void)
+{
+	char	**args;
+	int		count;
+	int		failed;
+
+	count = 100001;
+	args = malloc(sizeof(char *) * (count + 3));
+	if (!args)
+		return (expect(0, "malloc"));
+	args[0] = "test";
+	args[count + 1] = "x";
+	args[count + 2] = NULL;
+	while (count > 0)
+		args[count--] = "!";
+	failed = expect(builtin_test(args) == 1, "test ! ! ... x (odd count)");
+	free(args);
+	return (failed);
+}
+
+/**
+ * @brief builtin_test(): POSIX argument-count rules, the expression
+ *        grammar, integer parsing and `[` bracket checks
+ */
+int	test_builtin_test(void)
+{
+	int	failed;
+
+	failed = test_is("test", 1) + test_is("test x", 0) + test_is("test !", 0);
+	failed += test_is("test -n", 0) + test_is("test -z", 0);
+	failed += test_is("test ! x", 1) + test_is("test ! ! x", 0);
+	failed += test_is("test -n = -n", 0) + test_is("test ! = x", 1);
+	failed += test_is("test ( x )", 0) + test_is("test ( = )", 1);
+	failed += test_is("test ! -z x", 0) + test_is("test ! 1 -eq 1", 1);
+	failed += test_is("test 1 -eq 1 -a 2 -lt 3", 0);
+	failed += test_is("test 1 -eq 2 -o 3 -gt 2", 0);
+	failed += test_is("test 1 -eq 2 -o 3 -gt 2 -a 0 -ne 0", 1);
+	failed += test_is("test a = a", 0) + test_is("test a != a", 1);
+	failed += test_is("test -9223372036854775808 -lt 0", 0);
+	failed += test_is("test 9223372036854775807 -gt -1", 0);
+	failed += test_is("test 1 -eq x", 2);
+	failed += test_is("test 99999999999999999999 -gt 1", 2);
+	failed += test_is("test -d /", 0) + test_is("test -f /", 1);
+	failed += test_is("test -e /nonexistent/path", 1);
+	failed += test_is("[ 1 -eq 1 ]", 0) + test_is("[ ]", 1);
+	failed += test_is("[ 1 -eq 1", 2) + test_is("test ( x", 2);
+	failed += test_is("test x y", 2);
+	failed += test_empty_strings() + test_many_negations();
+	return (failed);
+}
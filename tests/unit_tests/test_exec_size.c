@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_exec_size.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#define _GNU_SOURCE
+#include "tests.h"
+
+#define ARG_LEN 100000
+
+/* Runs check_exec_size() with stderr muted, expecting E2BIG on failure. */
+static int	rejects(char **argv, const char *what)
+{
+	int	saved;
+	int	ret;
+
+	errno = 0;
+	saved = mute_stderr();
+	ret = check_exec_size(argv, NULL);
+	unmute_stderr(saved);
+	return (expect(ret == EXIT_CANNOT_EXECUTE && errno == E2BIG, what));
+}
+
+/* More ARG_LEN-byte arguments than _SC_ARG_MAX can hold. */
+static int	rejects_total(char *arg)
+{
+	char	**argv;
+	long	count;
+	long	i;
+	int		failed;
+
+	count = sysconf(_SC_ARG_MAX) / ARG_LEN + 2;
+	argv = malloc(sizeof(char *) * (count + 1));
+	if (!argv)
+		return (expect(0, "check_exec_size: malloc"));
+	i = 0;
+	while (i < count)
+	{
+		argv[i] = arg;
+		i++;
+	}
+	argv[count] = NULL;
+	failed = rejects(argv, "check_exec_size: argv over ARG_MAX");
+	free(argv);
+	return (failed);
+}
+
+#ifdef __linux__
+
+/* A single string over MAX_ARG_STRLEN fails even if the total fits. */
+static int	rejects_long_string(void)
+{
+	char	*argv[3];
+	int		failed;
+
+	argv[0] = "cmd";
+	argv[1] = malloc(200001);
+	argv[2] = NULL;
+	if (!argv[1])
+		return (expect(0, "check_exec_size: malloc"));
+	ft_memset(argv[1], 'x', 200000);
+	argv[1][200000] = '\0';
+	failed = rejects(argv, "check_exec_size: string over MAX_ARG_STRLEN");
+	free(argv[1]);
+	return (failed);
+}
+
+#else
+
+static int	rejects_long_string(void)
+{
+	return (0);
+}
+
+#endif
+
+/**
+ * @brief check_exec_size(): small vectors pass, oversized ones give 126
+ *        with errno set to E2BIG
+ */
+int	test_exec_size(void)
+{
+	char	*argv[3];
+	char	*arg;
+	int		failed;
+
+	argv[0] = "ls";
+	argv[1] = "-l";
+	argv[2] = NULL;
+	failed = expect(check_exec_size(argv, argv) == 0,
+			"check_exec_size: small argv");
+	arg = malloc(ARG_LEN);
+	if (!arg)
+		return (failed + expect(0, "check_exec_size: malloc"));
+	ft_memset(arg, 'a', ARG_LEN - 1);
+	arg[ARG_LEN - 1] = '\0';
+	failed += rejects_total(arg);
+	failed += rejects_long_string();
+	free(arg);
+	return (failed);
+}
@@ -0,0 +1,92 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_expand_word.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "tests.h"
+
+static int	expands_to(const char *word, const char *expected)
+{
+	t_shell	shell;
+	char	*out;
+	int		failed;
+
+	ft_memset(&shell, 0, sizeof(shell));
+	out = expand_word(word, &shell);
+	failed = expect(out && ft_strcmp(out, expected) == 0, word);
+	free(out);
+	return (failed);
+}
+
+/* Quotes are removed; only the quoting written in the word counts. */
+static int	removes_quotes(void)
+{
+	int	failed;
+
+	failed = expands_to("", "");
+	failed += expands_to("plain", "plain");
+	failed += expands_to("\"a'b\"", "a'b");
+	failed += expands_to("'a\"b'", "a\"b");
+	failed += expands_to("'a\\b'\"c\"", "a\\bc");
+	failed += expands_to("a\\ b\\'c", "a b'c");
+	failed += expands_to("\"a\\\"b\\$c\\d\"", "a\"b$c\\d");
+	failed += expands_to("\"it's\"", "it's");
+	failed += expands_to("trailing\\", "trailing\\");
+	return (failed);
+}
+
+/* Arithmetic output is spliced in literally, and quoting still applies. */
+static int	expands_arith(void)
+{
+	int	failed;
+
+	failed = expands_to("$((1+2))", "3");
+	failed += expands_to("\"$((2*3))\"x", "6x");
+	failed += expands_to("'$((1))'", "$((1))");
+	failed += expands_to("\\$((1))", "$((1))");
+	failed += expands_to("a$((-4))b", "a-4b");
+	failed += expands_to("$", "$");
+	failed += expands_to("cost:$5", "cost:$5");
+	return (failed);
+}
+
+/* `$(...)` is kept as written until command substitution can run. */
+static int	keeps_cmd_subst(void)
+{
+	t_shell	shell;
+	char	*out;
+	int		saved;
+	int		failed;
+
+	failed = expands_to("$(echo 'a b')", "$(echo 'a b')");
+	failed += expands_to("\"$(printf \"a'b\")\"", "$(printf \"a'b\")");
+	failed += expands_to("$(unterminated", "$(unterminated");
+	ft_memset(&shell, 0, sizeof(shell));
+	saved = mute_stderr();
+	out = expand_word("x$((1/0))", &shell);
+	unmute_stderr(saved);
+	failed += expect(out == NULL && shell.exit_status == 1,
+			"expand_word: arithmetic error");
+	free(out);
+	return (failed);
+}
+
+/**
+ * @brief expand_word(): quote removal and `$((...))` in a single pass
+ */
+int	test_expand_word(void)
+{
+	int	failed;
+
+	failed = removes_quotes();
+	failed += expands_arith();
+	failed += keeps_cmd_subst();
+	return (failed);
+}
@@ -0,0 +1,138 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_fd_transfer.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#define _GNU_SOURCE
+#include "tests.h"
+#include <sys/socket.h>
+
+/* More than one FD_TRANSFER_BUF chunk; streams stay under a pipe's buffer */
+#define FILE_SIZE 3000000
+#define STREAM_SIZE 60000
+
+/* Writes n bytes of a position-dependent pattern to fd. */
+static int	fill(int fd, size_t n)
+{
+	char	buf[4096];
+	size_t	i;
+	size_t	len;
+
+	i = 0;
+	while (i < n)
+	{
+		len = 0;
+		while (len < sizeof(buf) && i + len < n)
+		{
+			buf[len] = (char)((i + len) % 251);
+			len++;
+		}
+		if (write(fd, buf, len) != (ssize_t)len)
+			return (-1);
+		i += len;
+	}
+	return (0);
+}
+
+/* Checks that fd holds exactly n pattern bytes, starting at offset from. */
+static int	holds(int fd, size_t from, size_t n)
+{
+	char	buf[4096];
+	ssize_t	got;
+	ssize_t	i;
+	size_t	pos;
+
+	if (lseek(fd, 0, SEEK_SET) < 0)
+		return (0);
+	pos = 0;
+	got = read(fd, buf, sizeof(buf));
+	while (got > 0)
+	{
+		i = 0;
+		while (i < got)
+		{
+			if (buf[i] != (char)((from + pos + i) % 251))
+				return (0);
+			i++;
+		}
+		pos += got;
+		got = read(fd, buf, sizeof(buf));
+	}
+	return (got == 0 && pos == n);
+}
+
+/* copy_file_range() path, starting from the source's current offset. */
+static int	regular_to_regular(void)
+{
+	FILE	*in;
+	FILE	*out;
+	int		failed;
+
+	in = tmpfile();
+	out = tmpfile();
+	if (!in || !out || fill(fileno(in), FILE_SIZE) < 0
+		|| lseek(fileno(in), 10, SEEK_SET) != 10)
+		failed = expect(0, "fd_transfer: regular file setup");
+	else
+	{
+		failed = expect(fd_transfer(fileno(in), fileno(out))
+				== FILE_SIZE - 10, "fd_transfer: regular to regular");
+		failed += expect(holds(fileno(out), 10, FILE_SIZE - 10),
+				"fd_transfer: regular to regular data");
+	}
+	if (in)
+		fclose(in);
+	if (out)
+		fclose(out);
+	return (failed);
+}
+
+/* A pipe takes the splice() path, a socket the read/write fallback. */
+static int	stream_to_file(int use_socket, const char *what)
+{
+	int		fds[2];
+	FILE	*out;
+	int		failed;
+
+	if (use_socket)
+		failed = socketpair(AF_UNIX, SOCK_STREAM, 0, fds) < 0;
+	else
+		failed = pipe(fds) < 0;
+	if (failed)
+		return (expect(0, what));
+	out = tmpfile();
+	failed = expect(out && fill(fds[1], STREAM_SIZE) == 0, what);
+	close(fds[1]);
+	if (!failed)
+	{
+		failed = expect(fd_transfer(fds[0], fileno(out)) == STREAM_SIZE,
+				what);
+		failed += expect(holds(fileno(out), 0, STREAM_SIZE), what);
+	}
+	close(fds[0]);
+	if (out)
+		fclose(out);
+	return (failed);
+}
+
+/**
+ * @brief fd_transfer(): each copy strategy moves every byte, in order
+ */
+int	test_fd_transfer(void)
+{
+	int	failed;
+
+	failed = regular_to_regular();
+	failed += stream_to_file(0, "fd_transfer: pipe to file");
+	failed += stream_to_file(1, "fd_transfer: socket to file (fallback)");
+	failed += expect(fd_transfer(-1, STDOUT_FILENO) == -1 && errno == EBADF,
+			"fd_transfer: bad descriptor");
+	return (failed);
+}
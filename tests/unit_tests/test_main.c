@@ -0,0 +1,76 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_main.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "tests.h"
+
+int	expect(int ok, const char *what)
+{
+	if (!ok)
+		fprintf(stderr, "KO: %s\n", what);
+	return (!ok);
+}
+
+int	mute_stderr(void)
+{
+	int	saved;
+	int	null_fd;
+
+	fflush(stderr);
+	saved = dup(STDERR_FILENO);
+	null_fd = open("/dev/null", O_WRONLY);
+	if (null_fd >= 0)
+	{
+		dup2(null_fd, STDERR_FILENO);
+		close(null_fd);
+	}
+	return (saved);
+}
+
+void	unmute_stderr(int saved)
+{
+	fflush(stderr);
+	if (saved < 0)
+		return ;
+	dup2(saved, STDERR_FILENO);
+	close(saved);
+}
+
+/**
+ * @brief Runs every unit test suite
+ * @return int EXIT_SUCCESS if all checks passed, EXIT_FAILURE otherwise
+ */
+int	main(int argc, char **argv, char **envp)
+{
+	int	failed;
+
+	(void)argc;
+	(void)argv;
+	(void)envp;
+	failed = test_numbers();
+	failed += test_arith();
+	failed += test_arith_errors();
+	failed += test_expand_word();
+	failed += test_builtin_test();
+	failed += test_read();
+	failed += test_fd_transfer();
+	failed += test_signals();
+	failed += test_wait();
+	failed += test_strvec();
+	failed += test_exec_size();
+	if (failed)
+	{
+		printf("%d check(s) failed\n", failed);
+		return (EXIT_FAILURE);
+	}
+	printf("All unit tests passed\n");
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,63 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_numbers.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "tests.h"
+
+static int	atoll_is(const char *str, long long expected)
+{
+	long long	value;
+
+	value = 0;
+	return (expect(ft_atoll(str, &value) == 0 && value == expected, str));
+}
+
+static int	atoll_rejects(const char *str)
+{
+	long long	value;
+
+	return (expect(ft_atoll(str, &value) < 0, str));
+}
+
+static int	lltoa_is(long long n, const char *expected)
+{
+	char	*str;
+	int		failed;
+
+	str = ft_lltoa(n);
+	failed = expect(str && ft_strcmp(str, expected) == 0, expected);
+	free(str);
+	return (failed);
+}
+
+/**
+ * @brief ft_atoll() is strict and exact on the whole 64-bit range;
+ *        ft_lltoa() round-trips its extremes
+ */
+int	test_numbers(void)
+{
+	int	failed;
+
+	failed = atoll_is("0", 0) + atoll_is("-0", 0) + atoll_is("  42 \n", 42);
+	failed += atoll_is("+17", 17);
+	failed += atoll_is("9223372036854775807", LLONG_MAX);
+	failed += atoll_is("-9223372036854775808", LLONG_MIN);
+	failed += atoll_rejects("9223372036854775808");
+	failed += atoll_rejects("-9223372036854775809");
+	failed += atoll_rejects("99999999999999999999");
+	failed += atoll_rejects("") + atoll_rejects("   ") + atoll_rejects("-");
+	failed += atoll_rejects("12a") + atoll_rejects("4 2");
+	failed += atoll_rejects("--1") + atoll_rejects("0x10");
+	failed += lltoa_is(0, "0") + lltoa_is(-1, "-1") + lltoa_is(10, "10");
+	failed += lltoa_is(LLONG_MAX, "9223372036854775807");
+	failed += lltoa_is(LLONG_MIN, "-9223372036854775808");
+	return (failed);
+}
@@ -0,0 +1,123 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_read.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#define _GNU_SOURCE
+#include "tests.h"
+
+/* Feeds input to `read` through a regular file on stdin. */
+static int	feed_read(const char *input, const char *args_line, char ***env)
+{
+	t_shell	shell;
+	char	**args;
+	FILE	*tmp;
+	int		saved;
+	int		ret;
+
+	tmp = tmpfile();
+	args = ft_split(args_line, ' ');
+	ret = -1;
+	if (tmp && args && fputs(input, tmp) >= 0 && fflush(tmp) == 0)
+	{
+		rewind(tmp);
+		saved = dup(STDIN_FILENO);
+		dup2(fileno(tmp), STDIN_FILENO);
+		ft_memset(&shell, 0, sizeof(shell));
+		shell.env = *env;
+		ret = builtin_read(args, &shell);
+		*env = shell.env;
+		dup2(saved, STDIN_FILENO);
+		close(saved);
+	}
+	if (tmp)
+		fclose(tmp);
+	ft_free_array(args);
+	return (ret);
+}
+
+static int	var_is(char **env, const char *name, const char *expected)
+{
+	const char	*value;
+
+	value = ft_getenv(name, env);
+	return (expect(value && ft_strcmp(value, expected) == 0, expected));
+}
+
+/* Reads input with args and checks the first one or two variables. */
+static int	read_is(const char *input, const char *args, const char *a,
+			const char *b)
+{
+	char	**env;
+	int		failed;
+
+	env = malloc(sizeof(char *) * 2);
+	if (!env)
+		return (expect(0, "malloc"));
+	env[0] = ft_strdup("IFS= \t\n:");
+	env[1] = NULL;
+	failed = expect(feed_read(input, args, &env) == 0, input);
+	if (ft_strcmp(args, "read") == 0)
+		failed += var_is(env, "REPLY", a);
+	else
+		failed += var_is(env, "a", a);
+	if (b)
+		failed += var_is(env, "b", b);
+	ft_free_array(env);
+	return (failed);
+}
+
+/* Reads input that ends before a newline: names are still assigned. */
+static int	read_eof_is(const char *input, const char *args, const char *a,
+			const char *b)
+{
+	char	**env;
+	int		failed;
+
+	env = malloc(sizeof(char *) * 4);
+	if (!env)
+		return (expect(0, "malloc"));
+	env[0] = ft_strdup("a=foo");
+	env[1] = ft_strdup("b=foo");
+	env[2] = ft_strdup("REPLY=foo");
+	env[3] = NULL;
+	failed = expect(feed_read(input, args, &env) == 1, "status 1 at EOF");
+	if (ft_strcmp(args, "read") == 0)
+		failed += var_is(env, "REPLY", a);
+	else
+		failed += var_is(env, "a", a);
+	if (b)
+		failed += var_is(env, "b", b);
+	ft_free_array(env);
+	return (failed);
+}
+
+/**
+ * @brief builtin_read(): IFS splitting with escaped delimiters, -r,
+ *        line continuations, REPLY and assignment at EOF
+ */
+int	test_read(void)
+{
+	int	failed;
+
+	failed = read_is("x\\ y z\n", "read a b", "x y", "z");
+	failed += read_is("a\\:b:c\n", "read a b", "a:b", "c");
+	failed += read_is("a\\ b c\n", "read -r a b", "a\\", "b c");
+	failed += read_is("one \\\ntwo three\n", "read a b", "one", "two three");
+	failed += read_is("a\\\\\n", "read a", "a\\", NULL);
+	failed += read_is("  a\\  \n", "read a", "a ", NULL);
+	failed += read_is("p:q:r s\n", "read a b", "p", "q:r s");
+	failed += read_is("  lead \\t \n", "read", "  lead t ", NULL);
+	failed += read_eof_is("", "read a", "", NULL);
+	failed += read_eof_is("", "read a b", "", "");
+	failed += read_eof_is("", "read", "", NULL);
+	failed += read_eof_is("x y", "read a b", "x", "y");
+	read_cache_release();
+	return (failed);
+}
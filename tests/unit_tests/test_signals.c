@@ -0,0 +1,73 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_signals.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#define _GNU_SOURCE
+#include "tests.h"
+
+/* Raises sig and checks it comes back from the signal descriptor. */
+static int	delivers(t_shell *shell, int sig, const char *what)
+{
+	int	failed;
+
+	raise(sig);
+	failed = expect(signals_next(shell->sig_fd) == sig, what);
+	failed += expect(signals_next(shell->sig_fd) == 0, what);
+	return (failed);
+}
+
+/* A Ctrl-C queued during a foreground job is dropped, SIGCHLD is not. */
+static int	discards_stale_sigint(t_shell *shell)
+{
+	siginfo_t	info;
+	pid_t		pid;
+	int			failed;
+
+	pid = fork();
+	if (pid == 0)
+		_exit(3);
+	if (pid < 0 || waitid(P_PID, pid, &info, WEXITED | WNOWAIT) < 0)
+		return (expect(0, "discard_pending_signals: fork"));
+	raise(SIGINT);
+	shell->exit_status = 0;
+	discard_pending_signals(shell);
+	failed = expect(shell->exit_status == 3,
+			"discard_pending_signals: SIGCHLD still reaps");
+	failed += expect(waitpid(pid, NULL, WNOHANG) < 0 && errno == ECHILD,
+			"discard_pending_signals: child reaped");
+	failed += expect(signals_next(shell->sig_fd) == 0,
+			"discard_pending_signals: SIGINT dropped");
+	return (failed);
+}
+
+/**
+ * @brief signals_init()/signals_next(): blocked signals become events on
+ *        sig_fd, and discard_pending_signals() empties it
+ */
+int	test_signals(void)
+{
+	t_shell		shell;
+	sigset_t	old;
+	int			failed;
+
+	ft_memset(&shell, 0, sizeof(shell));
+	sigprocmask(SIG_SETMASK, NULL, &old);
+	if (signals_init(&shell) < 0)
+		return (expect(0, "signals_init"));
+	failed = expect(signals_next(shell.sig_fd) == 0, "signals_next: empty");
+	failed += delivers(&shell, SIGCHLD, "signals_next: SIGCHLD");
+	failed += delivers(&shell, SIGINT, "signals_next: SIGINT");
+	failed += delivers(&shell, SIGQUIT, "signals_next: SIGQUIT");
+	failed += discards_stale_sigint(&shell);
+	close(shell.sig_fd);
+	sigprocmask(SIG_SETMASK, &old, NULL);
+	return (failed);
+}
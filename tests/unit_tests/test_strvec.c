@@ -0,0 +1,90 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_strvec.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "tests.h"
+
+#define PUSHES 100000
+
+/* Pushes PUSHES numbered strings, counting how often the array moved. */
+static int	push_many(t_strvec *vec, int *grows)
+{
+	size_t	cap;
+	int		i;
+
+	*grows = 0;
+	i = 0;
+	while (i < PUSHES)
+	{
+		cap = vec->cap;
+		if (strvec_push(vec, ft_itoa(i)) < 0 || !vec->data[i]
+			|| vec->data[vec->len] != NULL)
+			return (-1);
+		if (vec->cap != cap)
+			(*grows)++;
+		i++;
+	}
+	return (0);
+}
+
+/* Capacity doubles from VEC_MIN_CAP: about log2(PUSHES / 16) moves. */
+static int	grows_geometrically(void)
+{
+	t_strvec	vec;
+	int			grows;
+	int			failed;
+
+	strvec_init(&vec);
+	failed = expect(push_many(&vec, &grows) == 0, "strvec_push: 100k pushes");
+	failed += expect(vec.len == PUSHES && vec.cap >= vec.len,
+			"strvec_push: length and capacity");
+	failed += expect(grows <= 14, "strvec_push: capacity doubles");
+	failed += expect(vec.data[PUSHES - 1]
+			&& ft_strcmp(vec.data[PUSHES - 1], "99999") == 0,
+			"strvec_push: last element");
+	strvec_free(&vec);
+	failed += expect(vec.data == NULL && vec.len == 0 && vec.cap == 0,
+			"strvec_free: vector reset");
+	return (failed);
+}
+
+static int	releases_array(void)
+{
+	t_strvec	vec;
+	char		**arr;
+	int			grows;
+	int			failed;
+
+	strvec_init(&vec);
+	arr = strvec_release(&vec);
+	failed = expect(arr && arr[0] == NULL, "strvec_release: empty vector");
+	free(arr);
+	failed += expect(push_many(&vec, &grows) == 0, "strvec_push: refill");
+	arr = strvec_release(&vec);
+	failed += expect(arr && ft_strcmp(arr[0], "0") == 0
+			&& arr[PUSHES] == NULL, "strvec_release: NULL-terminated");
+	failed += expect(vec.data == NULL && vec.len == 0,
+			"strvec_release: vector reset");
+	ft_free_array(arr);
+	return (failed);
+}
+
+/**
+ * @brief t_strvec: geometric growth over 100k pushes, release and free
+ */
+int	test_strvec(void)
+{
+	int	failed;
+
+	failed = grows_geometrically();
+	failed += releases_array();
+	return (failed);
+}
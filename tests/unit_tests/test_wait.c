@@ -0,0 +1,97 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_wait.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#define _GNU_SOURCE
+#include "tests.h"
+
+static pid_t	spawn(int exit_code, useconds_t delay)
+{
+	pid_t	pid;
+
+	pid = fork();
+	if (pid == 0)
+	{
+		if (delay)
+			usleep(delay);
+		_exit(exit_code);
+	}
+	return (pid);
+}
+
+static double	since(struct timeval *start, struct timeval *end)
+{
+	return ((end->tv_sec - start->tv_sec)
+		+ (end->tv_usec - start->tv_usec) / 1000000.0);
+}
+
+/* `sleep 0.3 | true`: the second stage must not inherit the first's end. */
+static int	stages_end_on_their_own(void)
+{
+	t_stage_usage	usage[2];
+	struct timeval	start;
+	pid_t			pids[2];
+	int				failed;
+
+	gettimeofday(&start, NULL);
+	pids[0] = spawn(0, 300000);
+	pids[1] = spawn(5, 0);
+	if (pids[0] < 0 || pids[1] < 0)
+		return (expect(0, "wait_children_usage: fork"));
+	failed = expect(wait_children_usage(pids, 2, usage) == 5,
+			"wait_children_usage: exit code of the last stage");
+	failed += expect(usage[0].pid == pids[0] && usage[1].pid == pids[1],
+			"wait_children_usage: both stages reaped");
+	failed += expect(since(&start, &usage[0].end) >= 0.3,
+			"wait_children_usage: slow stage end time");
+	failed += expect(since(&start, &usage[1].end) < 0.2,
+			"wait_children_usage: fast stage ends before the slow one");
+	return (failed);
+}
+
+/* Children that are not pipeline stages stay with their owner. */
+static int	leaves_other_children(void)
+{
+	t_stage_usage	usage[2];
+	siginfo_t		info;
+	pid_t			other;
+	pid_t			pids[2];
+	int				failed;
+
+	other = spawn(7, 0);
+	if (other < 0 || waitid(P_PID, other, &info, WEXITED | WNOWAIT) < 0)
+		return (expect(0, "wait_children_usage: fork"));
+	pids[0] = -1;
+	pids[1] = spawn(2, 50000);
+	failed = expect(wait_children_usage(pids, 2, usage) == 2,
+			"wait_children_usage: skips a stage that never started");
+	failed += expect(usage[0].pid == 0,
+			"wait_children_usage: unstarted stage keeps pid 0");
+	failed += expect(waitpid(other, NULL, WNOHANG) == other,
+			"wait_children_usage: other children are not reaped");
+	pids[0] = spawn(0, 0);
+	failed += expect(wait_for_children(pids, 1) == 0,
+			"wait_for_children: exit code");
+	return (failed);
+}
+
+/**
+ * @brief wait_children_usage(): per-stage end times in exit order, and
+ *        only the pipeline's own children are reaped
+ */
+int	test_wait(void)
+{
+	int	failed;
+
+	failed = stages_end_on_their_own();
+	failed += leaves_other_children();
+	return (failed);
+}
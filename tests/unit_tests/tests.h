@@ -0,0 +1,37 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   tests.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anpayot <anpayot@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:00:00 by anpayot           #+#    #+#             */
+/*   Updated: 2026/10/18 00:00:00 by anpayot          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef TESTS_H
+# define TESTS_H
+
+# include "../../includes/minishell.h"
+
+/* Reports one check; returns 1 if it failed so suites can sum failures. */
+int	expect(int ok, const char *what);
+
+/* Silences stderr around checks that are expected to print errors. */
+int	mute_stderr(void);
+void	unmute_stderr(int saved);
+
+int	test_numbers(void);
+int	test_arith(void);
+int	test_arith_errors(void);
+int	test_expand_word(void);
+int	test_builtin_test(void);
+int	test_read(void);
+int	test_fd_transfer(void);
+int	test_signals(void);
+int	test_wait(void);
+int	test_strvec(void);
+int	test_exec_size(void);
+
+#endif